@@ -0,0 +1,162 @@
+/**
+ * @file amutex.cpp
+ *
+ * @brief Envelope on the ESP mutexes api
+ *
+ * @date   Created on: 17 окт. 2026 г.
+ * @author aso
+ */
+
+
+#include <stdint.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "asemaphore"
+#include "amutex"
+#include "trace.hpp"
+
+
+
+//--[ class amutex_base ]----------------------------------------------------------------------------------------------
+///@brief Base of the amutex types;
+
+
+///@brief Destructor for Base of the amutex types; clear the mutex handler
+amutex_base::~amutex_base()
+{
+    free();
+}; /* amutex_base::~amutex_base() */
+
+
+///@brief initialize the mutex
+bool amutex_base::Init()
+{
+    instance = InitCore();
+    ASO_TRACE(init, instance, created());
+    return created();
+}; /* amutex_base::Init() */
+
+
+///@brief Take (lock) the mutex
+BaseType_t amutex_base::Take(TickType_t ticks)
+{
+    if (!created())
+	Init();
+
+    BaseType_t res = recursive? xSemaphoreTakeRecursive(instance, ticks): xSemaphoreTake(instance, ticks);
+    ASO_TRACE(take, instance, res);
+    return res;
+}; /* amutex_base::Take(TickType_t) */
+
+///@brief Give (unlock) the mutex; by the holder task only
+BaseType_t amutex_base::Give()
+{
+    if (!created())
+	return pdFAIL;
+
+    BaseType_t res = recursive? xSemaphoreGiveRecursive(instance): xSemaphoreGive(instance);
+    ASO_TRACE(give, instance, res);
+    return res;
+}; /* amutex_base::Give() */
+
+
+///@brief clear/delete mutex handler; after it - mutex is in not created state
+void amutex_base::del()
+{
+    if (created())
+    {
+	ASO_TRACE(del, instance, pdTRUE);
+	vSemaphoreDelete(instance);
+    }; /* if created() */
+    instance = nullptr;
+}; /* amutex_base::del() */
+
+
+
+//--[ class amutex ]---------------------------------------------------------------------------------------------------
+
+///@brief core of initializing mutex - simply create of it & return result
+SemaphoreHandle_t amutex::InitCore()
+{
+    return xSemaphoreCreateMutex();
+}; /* amutex::InitCore() */
+
+///@brief core of initializing mutex - simply create of it & return result
+SemaphoreHandle_t amutex::stat::InitCore()
+{
+    return xSemaphoreCreateMutexStatic(&body);
+}; /* amutex::stat::InitCore() */
+
+
+
+//--[ class amutex::adaptive ]----------------------------------------------------------------------------------------
+
+///@brief Take (lock) the adaptive lock
+BaseType_t amutex::adaptive::Take(TickType_t ticks)
+{
+    if (try_acquire())
+	return pdTRUE;
+
+    // spinning: the holder is expected to release it soon on the other core
+    for (unsigned i = 0; i < spin; i++)
+    {
+	aso::hw::relax();
+	if (state.load(std::memory_order_relaxed) == free && try_acquire())
+	{
+	    spun.fetch_add(1, std::memory_order_relaxed);
+	    return pdTRUE;
+	}; /* if state == free && try_acquire() */
+    }; /* for unsigned i = 0; i < spin; i++ */
+
+    if (ticks == 0)
+	return pdFAIL;
+
+    // blocking: mark the lock as contended, so the holder will wake the waiter
+    TimeOut_t timeout;
+    vTaskSetTimeOutState(&timeout);
+    while (state.exchange(contended, std::memory_order_acquire) != free)
+    {
+	parked.fetch_add(1, std::memory_order_relaxed);
+	if (xTaskCheckForTimeOut(&timeout, &ticks) == pdTRUE || wake.Take(ticks) != pdTRUE)
+	{
+	    ASO_TRACE(take, this, pdFAIL);
+	    return pdFAIL;
+	}; /* if timed out */
+    }; /* while state.exchange(contended) != free */
+
+    ASO_TRACE(take, this, pdTRUE);
+    return pdTRUE;
+}; /* amutex::adaptive::Take(TickType_t) */
+
+///@brief Give (unlock) the adaptive lock
+BaseType_t amutex::adaptive::Give()
+{
+    if (state.exchange(free, std::memory_order_release) == contended)
+    {
+	// the woken waiter leaves the state contended, so no wakeup is lost for the rest of waiters
+	wake.Give();
+	ASO_TRACE(give, this, pdTRUE);
+    }; /* if state.exchange(free) == contended */
+    return pdTRUE;
+}; /* amutex::adaptive::Give() */
+
+
+
+//--[ class arecursive_mutex ]-----------------------------------------------------------------------------------------
+
+///@brief core of initializing mutex - simply create of it & return result
+SemaphoreHandle_t arecursive_mutex::InitCore()
+{
+    return xSemaphoreCreateRecursiveMutex();
+}; /* arecursive_mutex::InitCore() */
+
+///@brief core of initializing mutex - simply create of it & return result
+SemaphoreHandle_t arecursive_mutex::stat::InitCore()
+{
+    return xSemaphoreCreateRecursiveMutexStatic(&body);
+}; /* arecursive_mutex::stat::InitCore() */
+
+
+//-[ EoF amutex.cpp ]--------------------------------------------------------------------------------------------------
@@ -0,0 +1,42 @@
+/*!@file argview.cpp
+ *
+ * @brief Views of the command arguments array as the string_views,
+ *	  implementation C++ body file
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <algorithm>
+
+#include "argview.hpp"
+
+
+namespace astr
+{
+
+    //! Make the view of the arguments array as the string_views, w/o copy of the arguments
+    std::span<std::string_view> argview(int argc, char* argv[], std::span<std::string_view> buf)
+    {
+	    size_t cnt = std::min(static_cast<size_t>(argc), buf.size());
+
+	for (size_t i = 0; i < cnt; i++)
+	    buf[i] = argv[i];
+	return buf.first(cnt);
+    }; /* astr::argview(int, char*[], std::span<std::string_view>) */
+
+    //! Make the view of the arguments array as the string_views, the storage of the views is allocated in the arena
+    std::span<std::string_view> argview(int argc, char* argv[], std::pmr::memory_resource* arena)
+    {
+	    std::pmr::polymorphic_allocator<std::string_view> alloc(arena);
+	    std::string_view* views = alloc.allocate(argc);
+
+	for (int i = 0; i < argc; i++)
+	    alloc.construct(views + i, argv[i]);
+	return {views, static_cast<size_t>(argc)};
+    }; /* astr::argview(int, char*[], std::pmr::memory_resource*) */
+
+}; /* namespace astr */
+
+
+//--[ argview.cpp ]----------------------------------------------------------------------------------------------------
@@ -0,0 +1,39 @@
+/*!@file argview.hpp
+ *
+ * @brief Views of the command arguments array as the string_views, w/o copy of the arguments;
+ *	  opt-in addition to the astring.h: pulls in the <span> & <memory_resource>
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __ARGVIEW_HPP__
+#define __ARGVIEW_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <memory_resource>
+#include <span>
+#include <string_view>
+
+
+namespace astr
+{
+
+    //! Make the view of the arguments array as the string_views, w/o copy of the arguments
+    // @param[in]  argc - counter of the strings in array
+    // @param[in]  argv - array of pointer to the asciiz strings
+    // @param[out] buf  - storage for the views
+    // @return          - span of the views of first argc (but not more then size of the buf) arguments
+    std::span<std::string_view> argview(int argc, char* argv[], std::span<std::string_view> buf);
+    //! Make the view of the arguments array as the string_views, w/o copy of the arguments
+    // @param[in]  arena - memory resource for the views storage, e.g. aso::arena: the only one allocation
+    // @return           - span of the views of the arguments
+    std::span<std::string_view> argview(int argc, char* argv[], std::pmr::memory_resource* arena);
+
+}; /* namespace astr */
+
+
+#endif /* __ARGVIEW_HPP__ */
@@ -14,9 +14,44 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 
+#include <esp_attr.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 
 #include "asemaphore"
+#include "trace.hpp"
+
+
+
+namespace
+{
+    ///@brief Initialize semaphore as binary semaphore if it is not initialized;
+    /// in the strict mode the semaphore must be initialized before use
+    inline void lazy_init(asemaphore_base& sem)
+    {
+#if CONFIG_ASO_UTILS_SEMAPHORE_STRICT_INIT
+	configASSERT(sem.created());
+#else
+	if (!sem.created())
+	    sem.InitBinary();
+#endif
+    }; /* lazy_init() */
+
+    ///@brief Give the semaphore up to n times with the one yield decision
+    ///@return count of the gives done: less than n if the semaphore was saturated
+    inline UBaseType_t give_batch(SemaphoreHandle_t sem, UBaseType_t n)
+    {
+	    UBaseType_t given = 0;
+
+	// defer the context switching to the end of the batch
+	vTaskSuspendAll();
+	while (given < n && xSemaphoreGive(sem) == pdPASS)
+	    given++;
+	xTaskResumeAll();
+	return given;
+    }; /* give_batch() */
+
+}; /* namespace */
 
 
 
@@ -36,6 +71,7 @@ asemaphore_base::~asemaphore_base()
 bool asemaphore_base::Init(bool opened)
 {
     instance = InitBinCore();
+    ASO_TRACE(init, instance, created());
     if (opened)
 	Give();
 
@@ -46,26 +82,158 @@ bool asemaphore_base::Init(bool opened)
 ///@brief Take (block) the semaphore
 BaseType_t asemaphore_base::Take(TickType_t ticks)
 {
-    // Initialize semaphore as binary semaphore if it is not initialized
-    if (!created())
-	InitBinary();
-
-    ESP_LOGW("asemaphore::Take(ticks)", "Take the semaphore handle with brake ticks is %lu", ticks);
+    lazy_init(*this);
+
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    // contended path is detected by the failed take w/o waiting
+    BaseType_t res = xSemaphoreTake(instance, 0);
+    if (res == pdTRUE || ticks == 0)
+	statistics.taken(res == pdTRUE);
+    else
+    {
+	int64_t start = esp_timer_get_time();
+	res = xSemaphoreTake(instance, ticks);
+	statistics.contended_taken(res == pdTRUE, static_cast<uint32_t>(esp_timer_get_time() - start));
+    }; /* else if res == pdTRUE || ticks == 0 */
+#else
     BaseType_t res = xSemaphoreTake(instance, ticks);
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    ASO_TRACE(take, instance, res);
     return res;
 }; /* asemaphore_base::Take(TickType_t) */
 
 ///@brief Give (release) the semaphore
 BaseType_t asemaphore_base::Give()
 {
-    // Initialize semaphore as binary semaphore if it is not initialized
+    lazy_init(*this);
+
+    BaseType_t res = xSemaphoreGive(instance);
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    if (res == pdTRUE)
+	statistics.given();
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    ASO_TRACE(give, instance, res);
+    return res;
+}; /* asemaphore_base::Give() */
+
+
+///@brief Take (all or nothing) the counting semaphore n times, waiting up to ticks for all of them
+BaseType_t asemaphore_base::Take(UBaseType_t n, TickType_t ticks)
+{
+	TimeOut_t timeout;
+	UBaseType_t taken = 0;
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+	int64_t start = -1;	///< start of the first blocked take, if any
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+
+    lazy_init(*this);
+
+    vTaskSetTimeOutState(&timeout);
+    for (; taken < n; taken++)
+    {
+	// the available units are taken w/o waiting & w/o the timeout bookkeeping;
+	// the contended path is detected by the failed take w/o waiting, as in the Take(TickType_t)
+	if (xSemaphoreTake(instance, 0) == pdTRUE)
+	    continue;
+	if (ticks == 0)
+	    break;
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+	if (start < 0)
+	    start = esp_timer_get_time();
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+	if (xSemaphoreTake(instance, ticks) != pdTRUE)
+	    break;
+	// rest of the waiting time for the next takes
+	if (xTaskCheckForTimeOut(&timeout, &ticks) != pdFALSE)
+	    ticks = 0;
+    }; /* for taken < n */
+
+    // not all taken - return the taken back; not counted as the gives, as the takes are not counted
+    if (taken < n && taken > 0)
+	give_batch(instance, taken);
+
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    if (start < 0)
+	statistics.taken(taken == n, n);
+    else
+	statistics.contended_taken(taken == n, static_cast<uint32_t>(esp_timer_get_time() - start), n);
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    ASO_TRACE(take, instance, taken == n);
+    return taken == n? pdTRUE: pdFALSE;
+}; /* asemaphore_base::Take(UBaseType_t, TickType_t) */
+
+///@brief Give the counting semaphore n times with the one yield decision
+BaseType_t asemaphore_base::Give(UBaseType_t n)
+{
+    lazy_init(*this);
+
+    UBaseType_t given = give_batch(instance, n);
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    statistics.given(given);
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+
+    BaseType_t res = given == n? pdPASS: pdFAIL;
+    ASO_TRACE(give, instance, res);
+    return res;
+}; /* asemaphore_base::Give(UBaseType_t) */
+
+
+///@brief Take the semaphore from the ISR, w/o waiting
+BaseType_t IRAM_ATTR asemaphore_base::TakeFromISR(BaseType_t* woken)
+{
+    // no lazy initializing in the ISR
     if (!created())
-	InitBinary();
+	return pdFAIL;
 
-    BaseType_t tmp = xSemaphoreGive(instance);
-    return tmp;
-//    return xSemaphoreGive(instance);
-}; /* asemaphore_base::Give() */
+    BaseType_t res = xSemaphoreTakeFromISR(instance, woken);
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    statistics.taken(res == pdTRUE);
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    ASO_TRACE_ISR(take, instance, res);
+    return res;
+}; /* asemaphore_base::TakeFromISR(BaseType_t*) */
+
+///@brief Give (release) the semaphore from the ISR
+BaseType_t IRAM_ATTR asemaphore_base::GiveFromISR(BaseType_t* woken)
+{
+    // no lazy initializing in the ISR
+    if (!created())
+	return pdFAIL;
+
+    BaseType_t res = xSemaphoreGiveFromISR(instance, woken);
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    if (res == pdTRUE)
+	statistics.given();
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    ASO_TRACE_ISR(give, instance, res);
+    return res;
+}; /* asemaphore_base::GiveFromISR(BaseType_t*) */
+
+///@brief Give the counting semaphore n times from the ISR, e.g. release the batch of the buffers
+BaseType_t IRAM_ATTR asemaphore_base::GiveFromISR(UBaseType_t n, BaseType_t* woken)
+{
+	BaseType_t res = pdPASS;
+	BaseType_t any_woken = pdFALSE;
+	UBaseType_t given = 0;
+
+    if (!created())
+	return pdFAIL;
+
+    for (BaseType_t one_woken = pdFALSE; given < n && res == pdPASS; given += res == pdPASS)
+    {
+	res = xSemaphoreGiveFromISR(instance, &one_woken);
+	any_woken |= one_woken;
+    }; /* for given < n && res == pdPASS */
+
+    if (woken != nullptr && any_woken)
+	*woken = pdTRUE;
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+    statistics.given(given);
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+
+    ASO_TRACE_ISR(give, instance, res);
+    return res;
+}; /* asemaphore_base::GiveFromISR(UBaseType_t, BaseType_t*) */
 
 
 ///@brief Get current count value if the semaphore is a counting semaphore
@@ -79,7 +247,10 @@ UBaseType_t asemaphore_base::count()
 void asemaphore_base::del()
 {
     if (created())
+    {
+	ASO_TRACE(del, instance, pdTRUE);
 	vSemaphoreDelete(instance);
+    }; /* if created() */
     instance = nullptr;
 }; /* asemaphore_base::del() */
 
@@ -99,7 +270,6 @@ asemaphore::asemaphore(bool opened)
 asemaphore::asemaphore(semaphore::init init)
 {
     Init(init);
-    ESP_LOGW("asemaphore::asemaphore(semaphore::init)", "Semaphore handle was %s", created()? "Created": "Not created");
 }; /* asemaphore::asemaphore(semaphore::init) */
 
 ///@brief Create the counting semaphore
@@ -107,7 +277,6 @@ asemaphore::asemaphore(semaphore::init init)
 ///@parameter [in] initc - initial count value assigned to the semaphore
 asemaphore::asemaphore(UBaseType_t maxc, UBaseType_t initc)
 {
-    ESP_LOGW("asemaphore::asemaphore(maxc, initc)", "Semaphore handle was %s", created()? "Created": "Not created");
     Init(maxc, initc);
 }; /* asemaphore::asemaphore(UBaseType_t, UBaseType_t) */
 
@@ -118,6 +287,7 @@ asemaphore::asemaphore(UBaseType_t maxc, UBaseType_t initc)
 bool asemaphore::Init(UBaseType_t maxc, UBaseType_t initc)
 {
     instance = xSemaphoreCreateCounting(maxc, initc);
+    ASO_TRACE(init, instance, created());
     return created();
 }; /* asemaphore::Init(UBaseType_t, UBaseType_t) */
 
@@ -139,7 +309,6 @@ SemaphoreHandle_t asemaphore::InitBinCore()
 asemaphore::stat::stat(bool opened)
 {
     Init(opened);
-    ESP_LOGW("asemaphore::stat::stat(bool)", "Semaphore handle was %s", created()? "Created": "Not created");
 }; /* asemaphore::asemaphore(bool) */
 
 ///@brief Create the binary semaphore with the enum semaphore::init
@@ -147,7 +316,6 @@ asemaphore::stat::stat(bool opened)
 asemaphore::stat::stat(semaphore::init init)
 {
     Init(init);
-    ESP_LOGW("asemaphore::stat::stat(semaphore::init)", "Semaphore handle was %s", created()? "Created": "Not created");
 }; /* asemaphore::stat::stat(semaphore::init) */
 
 ///@brief Create the counting semaphore
@@ -156,7 +324,6 @@ asemaphore::stat::stat(semaphore::init init)
 asemaphore::stat::stat(UBaseType_t maxc, UBaseType_t initc)
 {
     Init(maxc, initc);
-    ESP_LOGW("asemaphore::stat::stat(UBaseType_t, UBaseType_t)", "Semaphore handle was %s", created()? "Created": "Not created");
 }; /* asemaphore::asemaphore(UBaseType_t, UBaseType_t) */
 
 
@@ -167,6 +334,7 @@ asemaphore::stat::stat(UBaseType_t maxc, UBaseType_t initc)
 bool asemaphore::stat::Init(UBaseType_t maxc, UBaseType_t initc)
 {
     instance = xSemaphoreCreateCountingStatic(maxc, initc, &body);
+    ASO_TRACE(init, instance, created());
     return created();
 }; /* asemaphore::stat::Init(UBaseType_t, UBaseType_t) */
 
@@ -179,4 +347,96 @@ SemaphoreHandle_t asemaphore::stat::InitBinCore()
 }; /* asemaphore::stat::InitBinCore() */
 
 
+
+//--[ class asemaphore::notify ]---------------------------------------------------------------------------------------
+
+
+///@brief bind the semaphore to the waiting task & deliver it the latched gives
+void asemaphore::notify::bind(TaskHandle_t task)
+{
+    waiter.store(task);
+    if (!task)
+	return;
+
+    // the Give() latched after this store sees the task bound & delivers itself
+    for (UBaseType_t n = unlatch(); n > 0; n--)
+	xTaskNotifyGive(task);
+}; /* asemaphore::notify::bind(TaskHandle_t) */
+
+
+///@brief Take (block) the semaphore; by the bound task only, or bind the calling task if the semaphore was not bound
+BaseType_t asemaphore::notify::Take(TickType_t ticks)
+{
+    if (!created())
+	bind();
+
+    BaseType_t res = ulTaskNotifyTake(counting? pdFALSE: pdTRUE, ticks) > 0? pdTRUE: pdFALSE;
+    ASO_TRACE(take, task(), res);
+    return res;
+}; /* asemaphore::notify::Take(TickType_t) */
+
+///@brief Give (release) the semaphore; latched until the task is bound if the semaphore was not bound yet
+BaseType_t asemaphore::notify::Give()
+{
+	TaskHandle_t task = waiter.load();
+	UBaseType_t n = 1;
+
+    if (!task)
+    {
+	latch();
+	// the task may be bound after the check, but before the latch: deliver the latch by itself,
+	// with the gives of the other racing givers taken off together with it
+	if ((task = waiter.load()) == nullptr || (n = unlatch()) == 0)
+	{
+	    ASO_TRACE(give, task, pdPASS);
+	    return pdPASS;
+	}; /* if not bound yet or the latch was delivered by bind() */
+    }; /* if !task */
+
+    BaseType_t res = pdPASS;
+
+    for (; n > 0; n--)
+	res = xTaskNotifyGive(task);
+    ASO_TRACE(give, task, res);
+    return res;
+}; /* asemaphore::notify::Give() */
+
+///@brief Give (release) the semaphore from the ISR; latched if the semaphore was not bound yet
+BaseType_t IRAM_ATTR asemaphore::notify::GiveFromISR(BaseType_t* woken)
+{
+	TaskHandle_t task = waiter.load();
+	UBaseType_t n = 1;
+
+    if (!task)
+    {
+	latch();
+	if ((task = waiter.load()) == nullptr || (n = unlatch()) == 0)
+	{
+	    ASO_TRACE_ISR(give, task, pdPASS);
+	    return pdPASS;
+	}; /* if not bound yet or the latch was delivered by bind() */
+    }; /* if !task */
+
+    for (; n > 0; n--)
+	vTaskNotifyGiveFromISR(task, woken);
+    ASO_TRACE_ISR(give, task, pdPASS);
+    return pdPASS;
+}; /* asemaphore::notify::GiveFromISR(BaseType_t*) */
+
+///@brief Get current count value of the semaphore: the latched gives if the semaphore was not bound yet
+UBaseType_t asemaphore::notify::count()
+{
+	TaskHandle_t task = waiter.load();
+
+    if (!task)
+	return pending.load();
+#if tskKERNEL_VERSION_MAJOR > 10 || (tskKERNEL_VERSION_MAJOR == 10 && tskKERNEL_VERSION_MINOR >= 4)
+    // clear no bits - simply read the notification value
+    return ulTaskNotifyValueClear(task, 0);
+#else
+    return -1;
+#endif
+}; /* asemaphore::notify::count() */
+
+
 //-[ EoF asemaphore.cpp ]----------------------------------------------------------------------------------------------
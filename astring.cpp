@@ -11,26 +11,30 @@
  * @version: v.0.98
  */
 
+#include <array>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <string>
 
-#include <esp_log.h>
-
 #include "astring.h"
-#include "reversing.hpp"
+#include "charclass.hpp"
 
 /// @brief match the confirmation string
 /// pure C version
 bool yes_str(const char str[])
 {
-    return astr::confirm(str);
+    return !empty(str) && astr::confirm(str);
 }; /* yes_str() */
 
 /// @brief match negation string
 /// pure C version
 bool no_str(const char str[])
 {
-    return astr::decline(str);
+    return empty(str) || astr::decline(str);
 }; /* no_str() */
 
 
@@ -38,21 +42,122 @@ bool no_str(const char str[])
 namespace astr
 {
 
-    /// @brief matching confirmation string value
-    bool confirm(const std::string& bst)
+    namespace
     {
-	    std::string buf = tolower(bst);
+	/// @brief ASCII lower case of the char w/o locale table lookup
+	constexpr char lower(char c)
+	{
+	    return (c >= 'A' && c <= 'Z')? c + ('a' - 'A'): c;
+	}; /* lower() */
+
+	/// @brief keyword of the answer
+	struct keyword
+	{
+	    std::string_view word;
+	    answer kind;
+	}; /* keyword */
+
+	/// @brief perfect hash of the built-in answer keywords:
+	/// by first & last chars and length, case insensitive
+	constexpr size_t kwhash(std::string_view word)
+	{
+	    return (lower(word.front()) + 2 * lower(word.back()) + word.length()) & 7;
+	}; /* kwhash() */
+
+	/// @brief built-in keywords, lower case only
+	constexpr keyword builtin[] {
+	    {"y", answer::yes}, {"yes", answer::yes}, {"on", answer::yes}, {"ok", answer::yes},
+	    {"n", answer::no}, {"no", answer::no}, {"cancel", answer::no},
+	};
+
+	using kwtable = std::array<keyword, 8>;
+
+	/// @brief place built-in keywords to the hash table at compile time
+	constexpr kwtable mktable()
+	{
+		kwtable table {};
+
+	    for (const keyword& kw: builtin)
+		table[kwhash(kw.word)] = kw;
+	    return table;
+	}; /* mktable() */
+
+	constexpr kwtable kwords = mktable();
+
+	/// @brief is the hash table is perfect - no one keyword was lost on collision?
+	constexpr bool perfect()
+	{
+	    for (const keyword& kw: builtin)
+		if (kwords[kwhash(kw.word)].word != kw.word)
+		    return false;
+	    return true;
+	}; /* perfect() */
+
+	static_assert(perfect(), "collision in the answer keywords hash table - revise kwhash()");
 
-	return ((!is_zero(buf) && is_digitex(buf)) || buf == "on" || buf == "ok" || buf == "y" || buf == "yes");
-    }; /* astr::yes_str */
+	/// @brief case insensitive comparison of the string with the lower case word
+	bool equal_lower(std::string_view str, std::string_view lword)
+	{
+	    if (str.length() != lword.length())
+		return false;
+	    for (size_t i = 0; i < str.length(); i++)
+		if (lower(str[i]) != lword[i])
+		    return false;
+	    return true;
+	}; /* equal_lower() */
+
+	/// @brief the user's registered answer words
+	keyword userwords[8] {};
+	size_t userwords_cnt = 0;
+
+    }; /* namespace */
 
-    /// @brief match negation string value
-    bool decline(const std::string& bst)
+
+    /// @brief classify the answer string: "Yes"/"No" keyword or numeric value
+    /// Numeric value is a digits with optional spaces and/or underlines: zero is negation, non-zero - confirmation;
+    /// empty or space only string is negation.
+    answer answer_of(const std::string_view str)
+    {
+	    bool digit = false;		///< some digit is present
+	    bool nonzero = false;	///< some non-zero digit is present
+
+	for (char c: str)
+	    if (c >= '0' && c <= '9')
+	    {
+		digit = true;
+		nonzero = nonzero || c != '0';
+	    } /* if c is digit */
+	    else if (!chr::is(c, chr::space | chr::under))
+	    {
+		// not a numeric value - lookup the keyword tables
+		if (const keyword& kw = kwords[kwhash(str)]; !kw.word.empty() && equal_lower(str, kw.word))
+		    return kw.kind;
+		for (size_t i = 0; i < userwords_cnt; i++)
+		    if (equal_lower(str, userwords[i].word))
+			return userwords[i].kind;
+		return answer::none;
+	    }; /* else if c is not space & not underline */
+
+	if (!digit)
+	    return answer::no;	// empty or space only
+	return nonzero? answer::yes: answer::no;
+    }; /* astr::answer_of */
+
+
+    /// @brief register the user's confirmation or negation word
+    bool enroll_answer(const std::string_view word, answer kind)
     {
-	    std::string buf = tolower(bst);
+	if (kind == answer::none || word.empty() || userwords_cnt >= std::size(userwords))
+	    return false;
 
-	return (is_space(buf) || is_zero(buf) || buf == "n" || buf == "no" || buf == "cancel");
-    }; /* astr::no_str */
+	// stored in lower case for comparison
+	for (char c: word)
+	    if (lower(c) != c)
+		return false;
+
+	userwords[userwords_cnt++] = {word, kind};
+	return true;
+    }; /* astr::enroll_answer */
 
 
     /// String manipulation utility ---------------------------
@@ -61,52 +166,57 @@ namespace astr
     // return trimmed string - w/o leading & trailing spaces of the string
     std::string trimmed(const std::string& str)
     {
-	    const char* head = nullptr;
-	    const char* tail = nullptr;
+	return std::string(trimmed(std::string_view(str)));
+    }; /* astr::trimmed(const std::string&) */
 
-	for (const char &c : str)
-	    if (!std::isspace(c))
-	    {
-		head = &c;
-		break;
-	    }; /* if !std::isspace(c) */
 
-	for (const char& c : aso::adaptors::constant::reverse(str))
-	    if (!std::isspace(c))
-	    {
-		tail = &c + 1;
-		break;
-	    }; /* if !std::isspace(c) */
+    /// @brief trim leading & trailing spaces from the string "in place", w/o reallocation
+    std::string& trim(std::string& str)
+    {
+	    std::string_view vw(str);
 
-	return std::string(head, tail);
-    }; /* astr::trimmed(const std::string&) */
+	trim(vw);
+	str.erase(vw.data() - str.data() + vw.length());
+	str.erase(0, vw.data() - str.data());
+	return str;
+    }; /* astr::trim(std::string&) */
 
 
     /// @brief trim leading & trailong spacec from the string
     std::string_view& trim(std::string_view &vw)
     {
-	    bool space_only = true;
+	vw.remove_prefix(chr::span(vw, chr::space));
+	vw.remove_suffix(chr::rspan(vw, chr::space));
+	return vw;
+    }; /* astr::trim(std::string_view) */
 
-	for (const char &c : vw)
-	    if (!std::isspace(c))
-	    {
-		space_only = false;
-		vw.remove_prefix(std::distance(vw.begin(), &c));
-		break;
-	    }; /* if !std::isspace(c) */
 
-	if (space_only)
-	    vw.remove_suffix(vw.length());
+    /// @brief split the string to the two trimmed parts by the first delimiter
+    std::pair<std::string_view, std::string_view> split(std::string_view str, char delim)
+    {
+	    size_t pos = str.find(delim);
 
-	for (const char& c : aso::adaptors::constant::reverse(vw))
-	    if (!std::isspace(c))
-	    {
-		vw.remove_suffix(std::distance(&c, vw.end()) - 1);
-		break;
-	    }; /* if !std::isspace(c) */
+	if (pos == std::string_view::npos)
+	    return {trimmed(str), {}};
+	return {trimmed(str.substr(0, pos)), trimmed(str.substr(pos + 1))};
+    }; /* astr::split() */
 
-	return vw;
-    }; /* astr::trim(std::string_view) */
+
+    /// @brief cut the next trimmed non-empty token from the head of the string
+    std::string_view next_token(std::string_view& rest, std::string_view delims)
+    {
+	while (!rest.empty())
+	{
+		size_t pos = rest.find_first_of(delims);
+		std::string_view token = rest.substr(0, pos);
+
+	    rest.remove_prefix(pos == std::string_view::npos? rest.length(): pos + 1);
+	    if (!trim(token).empty())
+		return token;
+	}; /* while !rest.empty() */
+
+	return {};
+    }; /* astr::next_token() */
 
 
     /// string to lower case
@@ -118,58 +228,157 @@ namespace astr
     }; /* astr::tolower */
 
     /// string with only space chars or empty?
-    bool is_space(const std::string& str)
+    bool is_space(const std::string_view str)
     {
-	    bool resf = true;
-
-	ESP_LOGD(__PRETTY_FUNCTION__, "Input string is: [%s]", str.c_str());
-
-	if (str == "")
-	    return true;
-
-	for (unsigned char c: str)
-	    if (!std::isspace(c))
-		resf = false;
-
-	return resf;
+	return chr::all(str, chr::space);
     }; /* astr::is_space */
 
 
     /// string with digit & optionsl spaces and/or underline
-    bool is_digitex(const std::string& str)
+    bool is_digitex(const std::string_view str)
     {
-	    bool withdigit = false;	///< detected digit in string
-	    bool spdigit = true;	///< detected non_digit && non_space && no underline chars
+	    // head w/o digits
+	    size_t head = chr::span(str, chr::space | chr::under);
 
-	for (unsigned char c: str)
-	{
-	    if (std::isdigit(c))
-		withdigit = true;
-	    else if (c != '_' || !std::isspace(c))
-		spdigit = false;
-	}; /* for unsigned char c: str */
-	return (withdigit && spdigit);
+	return head < str.length() && chr::all(str.substr(head), chr::digit | chr::space | chr::under);
     }; /* astr::is_digitex */
 
 
     /// string is zero only?
-    bool is_zero(const std::string& str)
+    bool is_zero(const std::string_view str)
     {
-	    bool accept = false;
-	    bool decline = false;
+	    // head w/o digits
+	    size_t head = chr::span(str, chr::space | chr::under);
 
-	if (!is_digitex(str))
-	    return false;
+	return head < str.length() && chr::all(str.substr(head), chr::zero | chr::space | chr::under);
+    }; /* astr::is_zero */
 
-	for (unsigned char c: str)
-	    if (c == '0')
-		accept = true;
-	    else if (!(std::isspace(c) || c == '.' || (std::tolower(static_cast<unsigned char>(c) == 'x'))))
-		decline = true;
 
-	return accept && !decline;
+    /// Values parsing ---------------------------------------
 
-    }; /* astr::is_zero */
+
+    namespace detail
+    {
+
+	/// @brief parse the integer: decimal, hexadecimal "0x..." or binary "0b..." with optional sign
+	/// & optional underlines between digits; surrounding spaces are allowed
+	bool parse_integer(std::string_view str, unsigned long long& magnitude, bool& negative)
+	{
+		unsigned base = 10;
+		bool digit = false;	///< previous char is a digit
+
+	    trim(str);
+	    negative = !str.empty() && str.front() == '-';
+	    if (!str.empty() && (str.front() == '-' || str.front() == '+'))
+		str.remove_prefix(1);
+
+	    if (str.length() > 2 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X'))
+		base = 16;
+	    else if (str.length() > 2 && str[0] == '0' && (str[1] == 'b' || str[1] == 'B'))
+		base = 2;
+	    if (base != 10)
+		str.remove_prefix(2);
+
+	    magnitude = 0;
+	    for (char c: str)
+	    {
+		    unsigned value;
+
+		if (c == '_' && digit)
+		{
+		    // separator is allowed between digits only
+		    digit = false;
+		    continue;
+		}; /* if c == '_' && digit */
+
+		if (chr::is(c, chr::digit))
+		    value = c - '0';
+		else if (chr::is(c, chr::xdigit))
+		    value = lower(c) - 'a' + 10;
+		else
+		    return false;
+
+		if (value >= base || __builtin_mul_overflow(magnitude, base, &magnitude)
+			|| __builtin_add_overflow(magnitude, value, &magnitude))
+		    return false;
+		digit = true;
+	    }; /* for char c: str */
+
+	    return digit;
+	}; /* astr::detail::parse_integer() */
+
+
+	/// @brief parse the floating point value: [sign] digits [. digits] [e|E [sign] digits],
+	/// with optional underlines between the mantissa digits; w/o inf, nan & hex-float forms
+	template <typename T>
+	static bool parse_real_core(std::string_view str, T& value)
+	{
+		char buf[64];		///< copy for the conversion, w/o the leading '+' & the separators
+		size_t len = 0;
+		size_t digits = 0;	///< count of the mantissa digits
+		bool exponent = false;	///< in the exponent part
+		bool point = false;	///< decimal point was met
+
+	    trim(str);
+	    if (str.empty() || str.length() >= sizeof(buf))
+		return false;
+
+	    // validate the whole grammar here: the converters accept "inf", "nan" & hex-float too
+	    for (size_t i = 0; i < str.length(); i++)
+	    {
+		    char c = str[i];
+
+		if (chr::is(c, chr::digit))
+		    digits += !exponent;
+		else if (c == '_')
+		{
+		    // separator is allowed between the mantissa digits only
+		    if (exponent || i == 0 || i + 1 == str.length() || !chr::is(str[i - 1], chr::digit) || !chr::is(str[i + 1], chr::digit))
+			return false;
+		    continue;
+		} /* else if c == '_' */
+		else if (c == '+' && i == 0)
+		    continue;	// the from_chars does not accept the '+'
+		else if (c == '-' && i == 0)
+		    ;
+		else if ((c == '-' || c == '+') && exponent && lower(str[i - 1]) == 'e')
+		    ;
+		else if (c == '.' && !point && !exponent)
+		    point = true;
+		else if (lower(c) == 'e' && !exponent && digits
+			&& i + 1 < str.length() && (chr::is(str[i + 1], chr::digit) || str[i + 1] == '-' || str[i + 1] == '+'))
+		    exponent = true;
+		else
+		    return false;
+		buf[len++] = c;
+	    }; /* for i < str.length() */
+	    if (!digits || (!chr::is(buf[len - 1], chr::digit) && buf[len - 1] != '.'))
+		return false;
+
+#ifdef __cpp_lib_to_chars
+	    // locale independent, w/o the errno
+	    auto [end, ec] = std::from_chars(buf, buf + len, value, std::chars_format::general);
+	    return ec == std::errc() && end == buf + len;
+#else
+	    // the validated grammar does not depend on the locale, but the decimal point of the strtod does
+	    char* end;
+
+	    buf[len] = '\0';
+	    errno = 0;
+	    long double result = strtold(buf, &end);
+	    if (end != buf + len || errno == ERANGE || std::fabs(result) > std::numeric_limits<T>::max()
+		    || (result != 0 && std::fabs(result) < std::numeric_limits<T>::denorm_min()))
+		return false;
+	    value = static_cast<T>(result);
+	    return true;
+#endif
+	}; /* astr::detail::parse_real_core() */
+
+	bool parse_real(std::string_view str, float& value) { return parse_real_core(str, value); };
+	bool parse_real(std::string_view str, double& value) { return parse_real_core(str, value); };
+	bool parse_real(std::string_view str, long double& value) { return parse_real_core(str, value); };
+
+    }; /* namespace detail */
 
 
 }; /* namespace astr */
@@ -18,6 +18,15 @@
 
 #ifdef __cplusplus
 
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
 /// Convert an identificator to a string (by enclosing the identifier in quotation marks)
 #define __INN_STR__(str) #str
 #define STRING(str) __INN_STR__(str)
@@ -113,6 +122,17 @@ namespace astr
 	holder.insert(std::end(holder), argv, argv + argc);
 	return holder;
     }; /* makestor() */
+    //! Make container, stored data from the pure C array, with the specified allocator: e.g.
+    //  makestor<std::pmr::vector<std::pmr::string>>(argc, argv, &pool) - all the memory is allocated from the pool
+    // @param[in]  alloc - allocator of the container (& of the elements for the std::pmr containers)
+    template <typename Holder, typename TData>
+    Holder makestor(int argc, TData argv[], const typename Holder::allocator_type& alloc)
+    {
+	    Holder holder(alloc);
+
+	holder.insert(std::end(holder), argv, argv + argc);
+	return holder;
+    }; /* makestor() */
 
 
     //! Make container with pointer to containers (e.g. list of the pointers to std::string)
@@ -136,6 +156,19 @@ namespace astr
 
         return holder;
     }; /* mk_containerholder() */
+    //! Make container with containers from the array of the pointer to asciiz string char*[], with the specified allocator:
+    //  e.g. mk_containerholder<std::pmr::list, std::pmr::basic_string>(argc, argv, &arena) - all the nodes & strings
+    //  are allocated in the arena & released in bulk with it
+    // @param[in]  alloc - allocator of the container (& of the elements for the std::pmr containers)
+    template <template <typename> class OutHolder, template <typename> class HoldStor, typename TData>
+    OutHolder<HoldStor<TData> > mk_containerholder(int argc, TData *argv[],
+	    const typename OutHolder<HoldStor<TData> >::allocator_type& alloc)
+    {
+	    OutHolder<HoldStor<TData> > holder(alloc);
+
+	holder.insert(holder.end(), argv, argv + argc);
+	return holder;
+    }; /* mk_containerholder() */
 
     /// @brief String 'str' is empty [""] or NULL?, C++ definition
 //    inline bool empty(const std::string& str)
@@ -144,15 +177,26 @@ namespace astr
         return str.empty();
     }; /*  empty */
 
+    /// @brief kind of the answer string - confirmation, negation or nothing of both
+    enum class answer { none, yes, no };
+
+    /// @brief classify the answer string: "Yes"/"No" keyword or numeric value
+    /// Single pass, case insensitive, w/o any allocation
+    answer answer_of(const std::string_view);
+
+    /// @brief register the user's confirmation (answer::yes) or negation (answer::no) word
+    /// @note  the word must be in the lower case and is not copied - it's storage must be static
+    ///        (e.g. string literal); intended for call at the initialization stage, not thread-safe
+    /// @return false if the user's words table is full, kind is answer::none or word is not lower case
+    bool enroll_answer(const std::string_view word, answer kind);
+
     /// @brief matching the confirmation string
     /// Is the string math the "Yes" string
-//    bool confirm(const std::string&);
-    bool confirm(const std::string_view);
+    inline bool confirm(const std::string_view str) { return answer_of(str) == answer::yes; };
 
     /// matching the negation string
     ///Is the string math the "No" string
-//    bool decline(const std::string&);
-    bool decline(const std::string_view);
+    inline bool decline(const std::string_view str) { return answer_of(str) == answer::no; };
 
     /// @brief Return the "Yes" string
     constexpr const char* yes() { return "y";};
@@ -165,13 +209,10 @@ namespace astr
     /// @brief return trimmed string - w/o leading & trailing spaces of the string
     /// @return  new trimmed string
     std::string trimmed(const std::string& str);
-    /// @brief trim leading & trailшng spacec from the string "in place"
+    /// @brief trim leading & trailшng spacec from the string "in place", w/o reallocation
     /// @param[in,out]  str - string for trailing spaces
     /// @return         trimmed passed string
-    inline std::string& trim(std::string& str) {
-	str = trimmed(str);
-	return str;
-    };
+    std::string& trim(std::string& str);
 
 
     /// @brief trim leading & trailong spaces from the string_view
@@ -184,17 +225,155 @@ namespace astr
     inline std::string_view trimmed(std::string_view strv) { return trim(strv); };
 
 
+    ///------- Tokenizing utility, w/o any allocation
+
+    /// @brief split the string to the two trimmed parts by the first delimiter, e.g. "key = value"
+    /// @return  pair of the trimmed parts; second is empty if the delimiter is absent
+    std::pair<std::string_view, std::string_view> split(std::string_view str, char delim = '=');
+
+    /// @brief space chars - default delimiters of the tokens
+    constexpr std::string_view spaces = " \t\n\v\f\r";
+
+    /// @brief cut the next trimmed non-empty token from the head of the string
+    /// @param[in,out] rest   - the string; the rest of it after the token & it's delimiter at return
+    /// @param[in]     delims - delimiters of the tokens
+    /// @return  the token, empty if no more tokens in the string
+    std::string_view next_token(std::string_view& rest, std::string_view delims = spaces);
+
+    /// @brief lazy range of the trimmed non-empty tokens of the string
+    /// e.g. for (std::string_view line: astr::tokens(text, "\n")) ...
+    class tokens
+    {
+    public:
+	explicit tokens(std::string_view str, std::string_view delims = spaces): text(str), delimiters(delims) {};
+
+	/// @brief input iterator through the tokens
+	class iterator
+	{
+	public:
+	    using iterator_category = std::input_iterator_tag;
+	    using value_type = std::string_view;
+	    using difference_type = std::ptrdiff_t;
+	    using pointer = const std::string_view*;
+	    using reference = const std::string_view&;
+
+	    /// @brief end of the tokens
+	    iterator() = default;
+	    iterator(std::string_view str, std::string_view delims): rest(str), delimiters(delims) { ++*this; };
+
+	    reference operator*() const { return token; };
+	    pointer operator->() const { return &token; };
+
+	    iterator& operator++() {
+		token = next_token(rest, delimiters);
+		return *this; };
+	    iterator operator++(int) { iterator tmp = *this; ++*this; return tmp; };
+
+	    /// the empty token is the end of the tokens
+	    bool operator==(const iterator& other) const { return token.empty() && other.token.empty(); };
+	    bool operator!=(const iterator& other) const { return !(*this == other); };
+
+	private:
+	    std::string_view rest;		///< not parsed rest of the string
+	    std::string_view delimiters;
+	    std::string_view token;		///< current token
+
+	}; /* astr::tokens::iterator */
+
+	iterator begin() const { return iterator(text, delimiters); };
+	iterator end() const { return iterator(); };
+
+    private:
+	std::string_view text;
+	std::string_view delimiters;
+
+    }; /* astr::tokens */
+
+
     /// @brief string to lower case
     std::string tolower(std::string);
 
     /// @brief string with only space chars or empty?
-    bool is_space(const std::string&);
+    bool is_space(const std::string_view);
 
     /// @brief string with digit & optionsl spaces and/or underline
-    bool is_digitex(const std::string&);
+    bool is_digitex(const std::string_view);
+
+    /// @brief string is zero only? - zero digits with optional spaces and/or underline
+    bool is_zero(const std::string_view);
 
-    /// @brief string is zero only?
-    bool is_zero(const std::string&);
+
+    ///------- Values parsing, w/o allocation & w/o NUL termination of the string
+
+    namespace detail
+    {
+	/// @brief parse the integer: decimal, hexadecimal "0x..." or binary "0b..." with optional sign
+	/// & optional underlines between digits; surrounding spaces are allowed
+	/// @param[out] magnitude - absolute value
+	/// @param[out] negative  - sign of the value
+	/// @return false if the string is not an integer or the value is out of the unsigned long long range
+	bool parse_integer(std::string_view str, unsigned long long& magnitude, bool& negative);
+
+	/// @brief parse the floating point value: [sign] digits [. digits] [e|E [sign] digits]
+	/// with optional underlines between the mantissa digits, independent of the locale;
+	/// surrounding spaces are allowed
+	/// @return false if the string is not a decimal floating point value (inf, nan & hex-float too)
+	/// or the value is out of the range of the type
+	bool parse_real(std::string_view str, float& value);
+	bool parse_real(std::string_view str, double& value);
+	bool parse_real(std::string_view str, long double& value);
+
+    }; /* namespace detail */
+
+    /// @brief parse the value of type T from the string, in the spirit of the std::from_chars:
+    /// integers - decimal, hex "0x..." & binary "0b..." with '_' digit separators; decimal floats, locale independent; bool - by the confirm/decline words;
+    /// surrounding spaces are allowed
+    /// @return the value or std::nullopt if the string is not a value of the type T or it is out of range of T
+    template <typename T>
+    std::optional<T> parse(std::string_view str)
+    {
+	if constexpr (std::is_same_v<T, bool>)
+	{
+	    if (is_space(str))
+		return std::nullopt;
+	    switch (answer_of(trimmed(str)))
+	    {
+	    case answer::yes:	return true;
+	    case answer::no:	return false;
+	    default:		return std::nullopt;
+	    }; /* switch answer_of(str) */
+	} /* if T is bool */
+	else if constexpr (std::is_integral_v<T>)
+	{
+		unsigned long long magnitude;
+		bool negative;
+
+	    if (!detail::parse_integer(str, magnitude, negative))
+		return std::nullopt;
+	    if constexpr (std::is_signed_v<T>)
+	    {
+		if (!negative)
+		    return magnitude <= static_cast<unsigned long long>(std::numeric_limits<T>::max())?
+			    std::optional<T>(static_cast<T>(magnitude)): std::nullopt;
+		if (magnitude == 0)
+		    return T(0);
+		return magnitude - 1 <= static_cast<unsigned long long>(std::numeric_limits<T>::max())?
+			std::optional<T>(static_cast<T>(-static_cast<long long>(magnitude - 1) - 1)): std::nullopt;
+	    } /* if T is signed */
+	    else
+		return (magnitude <= std::numeric_limits<T>::max() && (!negative || magnitude == 0))?
+			std::optional<T>(static_cast<T>(magnitude)): std::nullopt;
+	} /* else if T is integral */
+	else
+	{
+	    static_assert(std::is_floating_point_v<T>, "astr::parse<T>: T must be bool, integral or floating point type");
+		T value;
+
+	    if (detail::parse_real(str, value))
+		return value;
+	    return std::nullopt;
+	}; /* else T is floating point */
+    }; /* astr::parse<T> */
 
 }; /* astr */
 
@@ -0,0 +1,105 @@
+/*!@file blocking.hpp
+ *
+ * @brief Blocking adapter for the non-blocking queues (push/pop returns false when full/empty):
+ *	  waiting on the counting semaphores, that are touched only on the empty/full edges
+ *
+ * @note  Need pre-included including files semphr.h & asemaphore
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __BLOCKING_HPP__
+#define __BLOCKING_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <atomic>
+
+
+namespace aso
+{
+
+    ///@brief blocking adapter for the non-blocking queue
+    /// Queue must provide bool push(const T&), bool push(T&&), bool pop(T&) & static capacity();
+    /// the semaphores are used only if some task is waiting, so non-blocking operations stay lock-free
+    template <typename Queue>
+    class blocking: public Queue
+    {
+    public:
+	using Queue::Queue;
+
+	///@brief push the item to the queue, waiting up to ticks while the queue is full
+	template <typename V>
+	bool push_wait(V&& item, TickType_t ticks = portMAX_DELAY) {
+	    return wait(producers, not_full, ticks, [&]{ return Queue::push(std::forward<V>(item)); }) && notify(consumers, not_empty); };
+
+	///@brief pop the item from the queue, waiting up to ticks while the queue is empty
+	template <typename V>
+	bool pop_wait(V& item, TickType_t ticks = portMAX_DELAY) {
+	    return wait(consumers, not_empty, ticks, [&]{ return Queue::pop(item); }) && notify(producers, not_full); };
+
+	///@brief push the item to the queue w/o waiting, wake up the waiting consumer
+	template <typename V>
+	bool push(V&& item) {
+	    return Queue::push(std::forward<V>(item)) && notify(consumers, not_empty); };
+
+	///@brief pop the item from the queue w/o waiting, wake up the waiting producer
+	template <typename V>
+	bool pop(V& item) {
+	    return Queue::pop(item) && notify(producers, not_full); };
+
+    protected:
+
+	///@brief try the operation, while it is failed - wait for the semaphore sem up to ticks
+	template <typename Op>
+	static bool wait(std::atomic<int>& waiters, asemaphore_base& sem, TickType_t ticks, Op&& op)
+	{
+		TimeOut_t timeout;
+
+	    if (op())
+		return true;
+
+	    vTaskSetTimeOutState(&timeout);
+	    for (;;)
+	    {
+		waiters.fetch_add(1, std::memory_order_seq_cst);
+		// re-check after registering as waiter: the edge may passed before
+		if (op())
+		{
+		    waiters.fetch_sub(1, std::memory_order_relaxed);
+		    return true;
+		}; /* if op() */
+
+		    bool signaled = sem.Take(ticks) == pdTRUE;
+
+		waiters.fetch_sub(1, std::memory_order_relaxed);
+		if (op())
+		    return true;
+		if (!signaled || xTaskCheckForTimeOut(&timeout, &ticks) != pdFALSE)
+		    return false;
+	    }; /* for (;;) */
+	}; /* wait() */
+
+	///@brief wake up the waiting side, if it is present
+	static bool notify(std::atomic<int>& waiters, asemaphore_base& sem)
+	{
+	    std::atomic_thread_fence(std::memory_order_seq_cst);
+	    if (waiters.load(std::memory_order_relaxed) > 0)
+		sem.Give();
+	    return true;
+	}; /* notify() */
+
+	std::atomic<int> producers {0};		///< count of the producers waiting while the queue is full
+	std::atomic<int> consumers {0};		///< count of the consumers waiting while the queue is empty
+	asemaphore::stat not_full {static_cast<UBaseType_t>(Queue::capacity()), 0};	///< signal "queue is not full more"
+	asemaphore::stat not_empty {static_cast<UBaseType_t>(Queue::capacity()), 0};	///< signal "queue is not empty more"
+
+    }; /* aso::blocking */
+
+}; /* namespace aso */
+
+
+#endif /* __BLOCKING_HPP__ */
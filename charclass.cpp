@@ -0,0 +1,154 @@
+/*!@file charclass.cpp
+ *
+ * @brief Character classes engine: word-at-a-time (SWAR) scanning of the strings,
+ *	  implementation C++ body file
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <climits>
+#include <cstring>
+
+#include "charclass.hpp"
+
+
+namespace astr
+{
+    namespace chr
+    {
+	namespace
+	{
+	    /// machine word: 4 bytes on the ESP32 cores, 8 bytes on the 64-bit host
+	    using word = uintptr_t;
+
+	    /// the byte b, repeated in all bytes of the word
+	    constexpr word rep(uint8_t b) { return ~word(0) / 0xff * b; };
+
+	    constexpr word high = rep(0x80);
+	    constexpr word low7 = rep(0x7f);
+
+	    /// the bytes >= n (n = 1..0x80), marked by the high bit in each byte; exact for each byte - w/o carry between bytes
+	    constexpr word ge(word w, uint8_t n) { return (((w & low7) + rep(0x80 - n)) | w) & high; };
+
+	    /// the bytes == c, marked by the high bit in each byte
+	    constexpr word eq(word w, uint8_t c)
+	    {
+		    word y = w ^ rep(c);
+
+		return ~(((y & low7) + low7) | y) & high;
+	    }; /* eq() */
+
+	    /// the bytes in range lo..hi (hi < 0x80), marked by the high bit in each byte
+	    constexpr word range(word w, uint8_t lo, uint8_t hi) { return ge(w, lo) & ~ge(w, hi + 1); };
+
+	    /// the bytes belongs to the SWAR classes from the mask, marked by the high bit in each byte
+	    constexpr word classify(word w, uint16_t mask)
+	    {
+		    word res = 0;
+
+		if (mask & space)
+		    res |= eq(w, ' ') | range(w, '\t', '\r');
+		if (mask & digit)
+		    res |= range(w, '0', '9');
+		else if (mask & zero)
+		    res |= eq(w, '0');
+		if (mask & under)
+		    res |= eq(w, '_');
+		return res;
+	    }; /* classify() */
+
+	    static_assert(classify(rep(' '), space) == high && classify(rep('\r'), space) == high && classify(rep('\x0e'), space) == 0,
+		    "wrong SWAR classification of the space chars");
+	    static_assert(classify(rep('0'), digit) == high && classify(rep('9'), digit) == high && classify(rep(':'), digit) == 0
+		    && classify(rep('/'), digit) == 0 && classify(rep(0xb0), digit) == 0, "wrong SWAR classification of the digits");
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	    /// index of the first (in memory order) marked byte
+	    inline size_t first(word marks) { return __builtin_ctzl(marks) / CHAR_BIT; };
+	    /// index of the last (in memory order) marked byte
+	    inline size_t last(word marks) { return sizeof(word) - 1 - __builtin_clzl(marks) / CHAR_BIT; };
+#else
+	    inline size_t first(word marks) { return __builtin_clzl(marks) / CHAR_BIT; };
+	    inline size_t last(word marks) { return sizeof(word) - 1 - __builtin_ctzl(marks) / CHAR_BIT; };
+#endif
+
+	    /// load the word from the aligned address
+	    inline word load(const char* p)
+	    {
+		    word w;
+
+		memcpy(&w, __builtin_assume_aligned(p, sizeof(word)), sizeof(word));
+		return w;
+	    }; /* load() */
+
+	    inline bool aligned(const char* p) { return (reinterpret_cast<uintptr_t>(p) & (sizeof(word) - 1)) == 0; };
+
+	    /// length of the head, that chars belongs (inside = true) or not belongs (inside = false) to the classes
+	    size_t scan(std::string_view str, uint16_t mask, bool inside)
+	    {
+		    const char* p = str.data();
+		    const char* const end = p + str.length();
+
+		if ((mask & ~swar_classes) == 0)
+		{
+		    for (; p < end && !aligned(p); p++)
+			if (is(*p, mask) != inside)
+			    return p - str.data();
+
+		    for (; end - p >= static_cast<ptrdiff_t>(sizeof(word)); p += sizeof(word))
+			if (word miss = classify(load(p), mask) ^ (inside? high: 0); miss)
+			    return p - str.data() + first(miss);
+		}; /* if mask is the SWAR classes only */
+
+		for (; p < end; p++)
+		    if (is(*p, mask) != inside)
+			break;
+		return p - str.data();
+	    }; /* scan() */
+
+	}; /* namespace */
+
+
+	///@brief length of the head of the string, that chars belongs to the classes from the mask
+	size_t span(std::string_view str, uint16_t mask)
+	{
+	    return scan(str, mask, true);
+	}; /* astr::chr::span() */
+
+	///@brief length of the head of the string, that chars not belongs to any of the classes from the mask
+	size_t cspan(std::string_view str, uint16_t mask)
+	{
+	    return scan(str, mask, false);
+	}; /* astr::chr::cspan() */
+
+
+	///@brief length of the tail of the string, that chars belongs to the classes from the mask
+	size_t rspan(std::string_view str, uint16_t mask)
+	{
+		const char* const begin = str.data();
+		const char* p = begin + str.length();
+
+	    if ((mask & ~swar_classes) == 0)
+	    {
+		for (; p > begin && !aligned(p); p--)
+		    if (!is(p[-1], mask))
+			return begin + str.length() - p;
+
+		for (; p - begin >= static_cast<ptrdiff_t>(sizeof(word)); p -= sizeof(word))
+		    if (word miss = classify(load(p - sizeof(word)), mask) ^ high; miss)
+			return begin + str.length() - p + sizeof(word) - 1 - last(miss);
+	    }; /* if mask is the SWAR classes only */
+
+	    for (; p > begin; p--)
+		if (!is(p[-1], mask))
+		    break;
+	    return begin + str.length() - p;
+	}; /* astr::chr::rspan() */
+
+    }; /* namespace chr */
+
+}; /* namespace astr */
+
+
+//--[ charclass.cpp ]--------------------------------------------------------------------------------------------------
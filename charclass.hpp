@@ -0,0 +1,100 @@
+/*!@file charclass.hpp
+ *
+ * @brief Character classes engine: constexpr classification table w/o locale
+ *	  and word-at-a-time (SWAR) scanning of the strings
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __CHARCLASS_HPP__
+#define __CHARCLASS_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+namespace astr
+{
+    namespace chr
+    {
+
+	///@brief character classes, may be combined as the bit mask
+	enum cls: uint16_t
+	{
+	    space  = 0x001,	///< ' ', '\t', '\n', '\v', '\f', '\r'
+	    digit  = 0x002,	///< '0'..'9'
+	    xdigit = 0x004,	///< '0'..'9', 'a'..'f', 'A'..'F'
+	    upper  = 0x008,	///< 'A'..'Z'
+	    lower  = 0x010,	///< 'a'..'z'
+	    alpha  = upper | lower,
+	    alnum  = alpha | digit,
+	    punct  = 0x020,	///< printable, not alphanumeric & not space
+	    under  = 0x040,	///< '_'
+	    zero   = 0x080,	///< '0'
+	}; /* cls */
+
+	///@brief classes scanned by the word-at-a-time (SWAR), the rest - by bytes
+	constexpr uint16_t swar_classes = space | digit | under | zero;
+
+	///@brief build the classification table of the ASCII chars, the chars 0x80..0xff are out of any class
+	constexpr std::array<uint16_t, 256> mktable()
+	{
+		std::array<uint16_t, 256> table {};
+
+	    for (unsigned c = 0; c < 0x80; c++)
+	    {
+		if (c == ' ' || (c >= '\t' && c <= '\r'))
+		    table[c] |= space;
+		if (c >= '0' && c <= '9')
+		    table[c] |= digit | xdigit;
+		if ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+		    table[c] |= xdigit;
+		if (c >= 'A' && c <= 'Z')
+		    table[c] |= upper;
+		if (c >= 'a' && c <= 'z')
+		    table[c] |= lower;
+		if (c > ' ' && c < 0x7f && !(table[c] & alnum))
+		    table[c] |= punct;
+		if (c == '_')
+		    table[c] |= under;
+		if (c == '0')
+		    table[c] |= zero;
+	    }; /* for c < 0x80 */
+
+	    return table;
+	}; /* mktable() */
+
+	///@brief classification table
+	inline constexpr std::array<uint16_t, 256> table = mktable();
+
+	///@brief is the char belongs to any of the classes from the mask?
+	constexpr bool is(char c, uint16_t mask) { return table[static_cast<unsigned char>(c)] & mask; };
+
+	///@brief length of the head of the string, that chars belongs to the classes from the mask
+	size_t span(std::string_view str, uint16_t mask);
+
+	///@brief length of the head of the string, that chars not belongs to any of the classes from the mask
+	size_t cspan(std::string_view str, uint16_t mask);
+
+	///@brief length of the tail of the string, that chars belongs to the classes from the mask
+	size_t rspan(std::string_view str, uint16_t mask);
+
+	///@brief all chars of the string belongs to the classes from the mask? true for the empty string
+	inline bool all(std::string_view str, uint16_t mask) { return span(str, mask) == str.length(); };
+
+	///@brief is any char of the string belongs to the classes from the mask?
+	inline bool any(std::string_view str, uint16_t mask) { return cspan(str, mask) != str.length(); };
+
+    }; /* namespace chr */
+
+}; /* namespace astr */
+
+
+#endif /* __CHARCLASS_HPP__ */
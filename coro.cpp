@@ -0,0 +1,115 @@
+/*!@file coro.cpp
+ *
+ * @brief C++20 coroutines support: single-thread executor task, implementation C++ body file
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <sdkconfig.h>
+
+#if CONFIG_ASO_UTILS_COROUTINES
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <esp_event.h>
+
+#include "asemaphore"
+#include "amutex"
+#include "event_ctrl.hpp"
+#include "coro.hpp"
+
+
+
+namespace aso
+{
+    namespace coro
+    {
+
+	//--[ class executor ]-----------------------------------------------------------------------------------------
+
+	thread_local executor* executor::running = nullptr;
+
+
+	///@parameter [in] depth - length of the queue of the ready coroutines
+	executor::executor(UBaseType_t depth): queue(xQueueCreate(depth, sizeof(void*)))
+	{
+	}; /* executor::executor() */
+
+	executor::~executor()
+	{
+	    if (worker)
+		vTaskDelete(worker);
+	    if (created())
+		vQueueDelete(queue);
+	}; /* executor::~executor() */
+
+
+	///@brief create the executor task
+	bool executor::start(const char* name, uint32_t stack, UBaseType_t prio, BaseType_t core)
+	{
+	    if (!created() || worker)
+		return false;
+	    return xTaskCreatePinnedToCore(worker_proc, name, stack, this, prio, &worker, core) == pdPASS;
+	}; /* executor::start() */
+
+
+	///@brief start the coroutine at this executor
+	bool executor::spawn(task&& t, TickType_t ticks)
+	{
+	    return schedule(t.release(), ticks);
+	}; /* executor::spawn() */
+
+
+	///@brief schedule the suspended coroutine for resuming by this executor
+	bool executor::schedule(std::coroutine_handle<> h, TickType_t ticks)
+	{
+	    void* addr = h.address();
+	    return xQueueSend(queue, &addr, ticks) == pdTRUE;
+	}; /* executor::schedule() */
+
+	///@brief schedule the suspended coroutine for resuming by this executor, from ISR
+	bool executor::schedule_from_isr(std::coroutine_handle<> h, BaseType_t* woken)
+	{
+	    void* addr = h.address();
+	    return xQueueSendFromISR(queue, &addr, woken) == pdTRUE;
+	}; /* executor::schedule_from_isr() */
+
+
+	///@brief resume the one scheduled coroutine
+	bool executor::run_once(TickType_t ticks)
+	{
+		void* addr;
+
+	    if (xQueueReceive(queue, &addr, ticks) != pdTRUE)
+		return false;
+
+	    executor* outer = std::exchange(running, this);
+	    std::coroutine_handle<>::from_address(addr).resume();
+	    running = outer;
+	    return true;
+	}; /* executor::run_once() */
+
+	///@brief resume the scheduled coroutines forever
+	void executor::run()
+	{
+	    for (;;)
+		run_once();
+	}; /* executor::run() */
+
+
+	void executor::worker_proc(void* arg)
+	{
+	    static_cast<executor*>(arg)->run();
+	}; /* executor::worker_proc() */
+
+    }; /* namespace coro */
+
+}; /* namespace aso */
+
+#endif	// CONFIG_ASO_UTILS_COROUTINES
+
+
+//--[ coro.cpp ]-------------------------------------------------------------------------------------------------------
@@ -0,0 +1,290 @@
+/*!@file coro.hpp
+ *
+ * @brief C++20 coroutines support: single-thread executor task, awaitable semaphores & events;
+ *	  many coroutines are waiting in the memory of the one executor task instead of the task per session
+ *
+ * @note  Need pre-included including files freertos/queue.h, semphr.h, esp_event.h, asemaphore, amutex & event_ctrl.hpp;
+ *	  the executor is built with the CONFIG_ASO_UTILS_COROUTINES only
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __CORO_HPP__
+#define __CORO_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <atomic>
+#include <coroutine>
+#include <cstdlib>
+#include <utility>
+
+
+namespace aso
+{
+    namespace coro
+    {
+
+	class executor;
+
+
+	///@brief Fire-and-forget coroutine: created suspended, started by the executor::spawn(),
+	/// destroy itself at the end
+	class task
+	{
+	public:
+
+	    struct promise_type
+	    {
+		task get_return_object() { return task(std::coroutine_handle<promise_type>::from_promise(*this)); };
+		std::suspend_always initial_suspend() noexcept { return {}; };
+		std::suspend_never final_suspend() noexcept { return {}; };
+		void return_void() {};
+		void unhandled_exception() { abort(); };
+	    }; /* promise_type */
+
+	    task(task&& other): handle(std::exchange(other.handle, nullptr)) {};
+	    task(const task&) = delete;
+	    task& operator=(const task&) = delete;
+
+	    ///@brief destroy the coroutine, that was never started
+	    ~task() { if (handle) handle.destroy(); };
+
+	    ///@brief take the coroutine handle from the task object: the coroutine is running now by itself
+	    std::coroutine_handle<> release() { return std::exchange(handle, nullptr); };
+
+	protected:
+	    explicit task(std::coroutine_handle<promise_type> h): handle(h) {};
+
+	    std::coroutine_handle<promise_type> handle;	///< handle of the not started coroutine
+
+	}; /* class task */
+
+
+
+	///@brief Single-thread executor: the FreeRTOS task, resuming the coroutines, scheduled through the queue
+	class executor
+	{
+	public:
+
+	    ///@parameter [in] depth - length of the queue of the ready coroutines
+	    explicit executor(UBaseType_t depth = 32);
+	    ~executor();
+
+	    executor(const executor&) = delete;
+	    executor& operator=(const executor&) = delete;
+
+	    ///@brief create the executor task
+	    bool start(const char* name = "coro", uint32_t stack = 4096, UBaseType_t prio = 5, BaseType_t core = tskNO_AFFINITY);
+
+	    ///@brief start the coroutine at this executor
+	    bool spawn(task&& t, TickType_t ticks = portMAX_DELAY);
+
+	    ///@brief schedule the suspended coroutine for resuming by this executor
+	    bool schedule(std::coroutine_handle<> h, TickType_t ticks = portMAX_DELAY);
+
+	    ///@brief schedule the suspended coroutine for resuming by this executor, from ISR
+	    bool schedule_from_isr(std::coroutine_handle<> h, BaseType_t* woken);
+
+	    ///@brief resume the one scheduled coroutine; used by executor task or for manual driving of the executor
+	    ///@return true if the coroutine was resumed, false on timeout
+	    bool run_once(TickType_t ticks = portMAX_DELAY);
+
+	    ///@brief resume the scheduled coroutines forever
+	    [[noreturn]] void run();
+
+	    ///@brief the executor, resuming the current coroutine; nullptr outside of the executor
+	    static executor* current() { return running; };
+
+	    ///@brief awaitable for rescheduling of the current coroutine to the end of the executor queue;
+	    /// outside of the executor the coroutine goes on w/o suspending
+	    struct yield
+	    {
+		bool await_ready() { return current() == nullptr; };
+		void await_suspend(std::coroutine_handle<> h) { current()->schedule(h); };
+		void await_resume() {};
+	    }; /* yield */
+
+	    ///@brief is executor was created?
+	    bool created() { return queue != nullptr; };
+
+	protected:
+
+	    static void worker_proc(void* arg);
+
+	    QueueHandle_t queue;		///< queue of the ready coroutines
+	    TaskHandle_t worker = nullptr;	///< executor task
+
+	    static thread_local executor* running;	///< the executor, resuming the current coroutine
+
+	}; /* class executor */
+
+
+
+	///@brief Semaphore with the awaitable take: co_await sem.async_take();
+	/// Give() resumes the waiting coroutine at it's executor first, then the count of the semaphore is given;
+	/// Give() is not ISR-safe & must be called through the async<> type, not through the asemaphore_base
+	///@tparam Semaphore - the underlying semaphore type: asemaphore, asemaphore::stat;
+	/// event::basic_sync<async<asemaphore>> is the awaitable event synchronizer
+	template <typename Semaphore>
+	class async: public Semaphore
+	{
+	public:
+
+	    using Semaphore::Semaphore;
+
+	    ///@brief awaiter of the semaphore take, node of the list of the waiters;
+	    /// outside of the executor no one can resume the coroutine: it blocks the calling task on the Take
+	    struct take_awaiter
+	    {
+		bool await_ready() { return sem.Take(exec? 0: portMAX_DELAY) == pdTRUE; };
+		bool await_suspend(std::coroutine_handle<> h) {
+		    configASSERT(exec && "aso::coro::async: co_await async_take() outside of the executor");
+		    waiting = h;
+		    return sem.enqueue(*this); };
+		void await_resume() {};
+
+		async& sem;				///< awaited semaphore
+		executor* exec = executor::current();	///< executor of the waiting coroutine
+		std::coroutine_handle<> waiting {};	///< waiting coroutine
+		take_awaiter* next = nullptr;		///< next waiter in the list
+	    }; /* take_awaiter */
+
+	    ///@brief awaitable take of the semaphore
+	    take_awaiter async_take() { return {*this}; };
+
+	    ///@brief give the semaphore to the first waiting coroutine, or give it's count if no one is waiting
+	    BaseType_t Give()
+	    {
+		take_awaiter* w;
+
+		guard.lock();
+		w = head;
+		if (w)
+		{
+		    head = w->next;
+		    if (!head)
+			tail = nullptr;
+		} /* if w */
+		else
+		{
+		    // count is given under the guard: waiter can't slip between empty list check & Give
+		    BaseType_t res = Semaphore::Give();
+		    guard.unlock();
+		    return res;
+		}; /* else if w */
+		guard.unlock();
+		return w->exec->schedule(w->waiting)? pdTRUE: pdFAIL;
+	    }; /* Give() */
+
+	protected:
+
+	    ///@brief enqueue the waiter, if the semaphore is not available still
+	    ///@return true if the coroutine is suspended, false if the semaphore was taken
+	    bool enqueue(take_awaiter& w)
+	    {
+		guard.lock();
+		if (Semaphore::Take(0) == pdTRUE)
+		{
+		    guard.unlock();
+		    return false;
+		}; /* if Semaphore::Take(0) == pdTRUE */
+		if (tail)
+		    tail->next = &w;
+		else
+		    head = &w;
+		tail = &w;
+		guard.unlock();
+		return true;
+	    }; /* enqueue() */
+
+	    amutex::stat guard;			///< guard of the waiters list
+	    take_awaiter* head = nullptr;	///< first waiter
+	    take_awaiter* tail = nullptr;	///< last waiter
+
+	}; /* class async */
+
+    }; /* namespace coro */
+
+}; /* namespace aso */
+
+
+
+namespace event
+{
+
+    ///@brief One-shot awaitable event: co_await event::awaitable<IP_EVENT, IP_EVENT_STA_GOT_IP>();
+    /// register the handler at the suspend, unregister it at the resume;
+    /// result of the co_await is the registration error code, ESP_OK if the event was fired,
+    /// ESP_ERR_INVALID_STATE if it is awaited outside of the executor
+    ///@tparam EvBase - event base
+    ///@tparam EvId   - event id, ESP_EVENT_ANY_ID for any event of the base
+    template <const esp_event_base_t& EvBase, int32_t EvId>
+    class awaitable: public handler::loop_base
+    {
+    public:
+
+	///@parameter [in] lp   - event loop; nullptr for the default system loop
+	explicit awaitable(esp_event_loop_handle_t lp = nullptr): handler::loop_base(lp, EvBase, EvId) {};
+
+	bool await_ready() { return false; };
+
+	bool await_suspend(std::coroutine_handle<> h)
+	{
+	    waiting = h;
+	    exec = aso::coro::executor::current();
+	    configASSERT(exec && "event::awaitable: co_await outside of the aso::coro::executor, no one can resume it");
+	    if (!exec)
+	    {
+		err = ESP_ERR_INVALID_STATE;
+		return false;
+	    }; /* if !exec */
+	    err = loop? esp_event_handler_instance_register_with(loop, ev_base, event, trampoline, this, &instance):
+		    esp_event_handler_instance_register(ev_base, event, trampoline, this, &instance);
+	    return err == ESP_OK;
+	}; /* await_suspend() */
+
+	esp_err_t await_resume()
+	{
+	    if (instance)
+	    {
+		if (loop)
+		    esp_event_handler_instance_unregister_with(loop, ev_base, event, instance);
+		else
+		    esp_event_handler_instance_unregister(ev_base, event, instance);
+		instance = nullptr;
+	    }; /* if instance */
+	    return err;
+	}; /* await_resume() */
+
+	///@brief id of the fired event: useful with the ESP_EVENT_ANY_ID
+	int32_t event_id() { return fired_id; };
+
+	///@brief resume the waiting coroutine at the first event only
+	void instance_handler(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data) override {
+	    if (fired.exchange(true))
+		return;
+	    fired_id = h_event;
+	    exec->schedule(waiting);
+	}; /* instance_handler() */
+
+    protected:
+
+	static void trampoline(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data) {
+	    static_cast<awaitable*>(arg)->instance_handler(nullptr, ev_base, h_event, data); };
+
+	aso::coro::executor* exec = nullptr;	///< executor of the waiting coroutine
+	std::coroutine_handle<> waiting {};	///< waiting coroutine
+	std::atomic<bool> fired {false};	///< event was fired already
+	int32_t fired_id = EvId;			///< id of the fired event
+	esp_err_t err = ESP_OK;			///< registration error code
+
+    }; /* event::awaitable */
+
+}; /* namespace event */
+
+
+#endif /* __CORO_HPP__ */
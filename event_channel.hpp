@@ -0,0 +1,198 @@
+/*!@file event_channel.hpp
+ *
+ * @brief Typed zero-copy event payload channel: the payload is placed to the pooled reference-counted slot,
+ *	  the event loop carries the pointer to the slot only, header template file
+ *
+ * @note  Need pre-included including files esp_event.h & event_ctrl.hpp
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __EVENT_CHANNEL_HPP__
+#define __EVENT_CHANNEL_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+
+namespace event
+{
+
+    ///@brief typed zero-copy event payload channel; the channel itself is the event handler of it's event base & id
+    /// & must be registered as any other handler (event::ctrl, event::table etc.);
+    /// it fans out the received payload to the subscribed handlers, the payload slot is returned to the pool
+    /// when the last handler finishes with it;
+    /// the slot of the event, that will never be dispatched (the loop was deleted, the channel was unregistered
+    /// before the event was dispatched), is returned to the pool by the reclaim() only
+    ///@tparam Payload	   - type of the event payload
+    ///@tparam N		   - count of the payload slots in the pool, up to 32
+    ///@tparam Subscribers - max count of the subscribed handlers
+    template <typename Payload, size_t N = 8, size_t Subscribers = 8>
+    class channel: public handler::base
+    {
+	static_assert(N > 0 && N <= 32, "event::channel pool size must be 1..32");
+
+    public:
+
+	///@brief typed handler of the channel payload
+	class typed: public handler::base
+	{
+	public:
+	    typed(): handler::base(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID) {};
+
+	    ///@brief receive the payload; it is valid up to return, or up to the channel::release() if it was retained
+	    virtual void receive(const Payload& payload) = 0;
+
+	    void instance_handler(void *arg, esp_event_base_t base, int32_t h_event, void *data) override {
+		receive(*static_cast<const Payload*>(data)); };
+
+	}; /* event::channel::typed */
+
+
+	///@brief create the channel for the event base & id, posting to the loop; nullptr - the default system loop
+	channel(esp_event_base_t ev_base, int32_t ev, esp_event_loop_handle_t lp = nullptr): handler::base(ev_base, ev), loop(lp) {};
+
+	///@brief the payloads of the not dispatched events are destroyed; the channel must be unregistered before
+	~channel() { reclaim(); };
+
+	///@brief subscribe the handler to the channel: typed or any handler::base descendant,
+	/// it gets the pointer to the payload as the event data; intended for the call before registering of the channel
+	///@return false if the subscribers table is full
+	bool subscribe(handler::base& h)
+	{
+	    if (subs_cnt >= Subscribers)
+		return false;
+	    subs[subs_cnt++] = &h;
+	    return true;
+	}; /* subscribe() */
+
+	///@brief unsubscribe the handler from the channel
+	void unsubscribe(handler::base& h)
+	{
+	    for (size_t i = 0; i < subs_cnt; i++)
+		if (subs[i] == &h)
+		{
+		    subs[i] = subs[--subs_cnt];
+		    return;
+		}; /* if subs[i] == &h */
+	}; /* unsubscribe() */
+
+	///@brief construct the payload in the free slot of the pool & post the event with pointer to it
+	///@return ESP_ERR_NO_MEM if there is no free slot, or the error of the esp_event_post
+	template <typename... Args>
+	esp_err_t post(TickType_t ticks, Args&&... args)
+	{
+		slot* s = acquire();
+		esp_err_t err;
+
+	    if (s == nullptr)
+		return ESP_ERR_NO_MEM;
+
+	    new (s->storage) Payload(std::forward<Args>(args)...);
+	    s->refs.store(1, std::memory_order_relaxed);
+	    s->posted.store(true, std::memory_order_relaxed);
+	    err = (loop == nullptr)?
+		    esp_event_post(ev_base, event, &s, sizeof(s), ticks):
+		    esp_event_post_to(loop, ev_base, event, &s, sizeof(s), ticks);
+	    if (err != ESP_OK)
+	    {
+		s->posted.store(false, std::memory_order_relaxed);
+		release(*s);
+	    }; /* if err != ESP_OK */
+	    return err;
+	}; /* post() */
+
+	///@brief return to the pool the slots of the posted, but not dispatched events: the event loop was deleted,
+	/// or the channel was unregistered & the events posted before are not pending in the loop queue any more;
+	/// the payload retained by the handlers is kept up to it's release()
+	///@note  the event, that is still in the loop queue, must not be dispatched to this channel after this call
+	///@return count of the reclaimed slots
+	size_t reclaim()
+	{
+		size_t cnt = 0;
+
+	    for (slot& s: slots)
+		if (s.posted.exchange(false, std::memory_order_relaxed))
+		{
+		    release(s);
+		    cnt++;
+		}; /* if s.posted */
+	    return cnt;
+	}; /* reclaim() */
+
+	///@brief keep the payload after return from the handler: up to the matched release()
+	void retain(const Payload& payload) {
+	    slot_of(payload).refs.fetch_add(1, std::memory_order_relaxed); };
+
+	///@brief release the retained payload
+	void release(const Payload& payload) {
+	    release(slot_of(payload)); };
+
+	///@brief count of the free slots in the pool
+	size_t available() const { return __builtin_popcount(free_mask.load(std::memory_order_relaxed)); };
+
+	///@brief fan out the payload to the subscribers & release it
+	void instance_handler(void *arg, esp_event_base_t base, int32_t h_event, void *data) override
+	{
+		slot* s = *static_cast<slot**>(data);
+
+	    s->posted.store(false, std::memory_order_relaxed);
+	    for (size_t i = 0; i < subs_cnt; i++)
+		subs[i]->instance_handler(subs[i]->arg, base, h_event, s->storage);
+	    release(*s);
+	}; /* instance_handler() */
+
+    protected:
+
+	///@brief payload slot of the pool
+	struct slot
+	{
+	    alignas(Payload) unsigned char storage[sizeof(Payload)];
+	    std::atomic<uint16_t> refs {0};
+	    std::atomic<bool> posted {false};	///< the event with the slot is posted, but not dispatched yet
+	}; /* slot */
+
+	///@brief take the free slot from the pool
+	slot* acquire()
+	{
+		uint32_t mask = free_mask.load(std::memory_order_relaxed);
+
+	    while (mask != 0)
+		if (free_mask.compare_exchange_weak(mask, mask & (mask - 1), std::memory_order_acquire, std::memory_order_relaxed))
+		    return &slots[__builtin_ctz(mask)];
+	    return nullptr;
+	}; /* acquire() */
+
+	///@brief drop the reference to the slot, return it to the pool by the last reference
+	void release(slot& s)
+	{
+	    if (s.refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+	    std::launder(reinterpret_cast<Payload*>(s.storage))->~Payload();
+	    free_mask.fetch_or(uint32_t(1) << (&s - slots), std::memory_order_release);
+	}; /* release() */
+
+	///@brief slot of the payload
+	slot& slot_of(const Payload& payload) {
+	    return slots[(reinterpret_cast<const unsigned char*>(&payload) - slots[0].storage) / sizeof(slot)]; };
+
+	esp_event_loop_handle_t loop;				///< loop for the posting
+	slot slots[N];						///< pool of the payload slots
+	std::atomic<uint32_t> free_mask {(N == 32)? ~uint32_t(0): (uint32_t(1) << N) - 1};	///< free slots of the pool
+	handler::base* subs[Subscribers] {};			///< subscribed handlers
+	size_t subs_cnt = 0;
+
+    }; /* event::channel */
+
+}; /* namespace event */
+
+
+#endif /* __EVENT_CHANNEL_HPP__ */
@@ -0,0 +1,98 @@
+/*!@file event_coalesce.cpp
+ *
+ * @brief Coalescing delivery of the high-frequency events, implementation C++ body file
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <sdkconfig.h>
+#include <freertos/FreeRTOS.h>
+#include <esp_attr.h>
+#include <esp_event.h>
+#include <esp_timer.h>
+
+#include "event_ctrl.hpp"
+#include "event_coalesce.hpp"
+
+
+
+namespace event
+{
+    namespace coalesce
+    {
+
+	//--[ class core ]---------------------------------------------------------------------------------------------
+
+	core::core(esp_event_loop_handle_t lp, esp_event_base_t bas, int32_t ev, uint64_t window):
+	    handler::loop_base(lp, bas, ev), window(window)
+	{
+	    if (window)
+	    {
+		const esp_timer_create_args_t args {
+		    .callback = post,
+		    .arg = this,
+		    .dispatch_method = ESP_TIMER_TASK,
+		    .name = "coalesce",
+		    .skip_unhandled_events = true,
+		};
+		esp_timer_create(&args, &timer);
+	    }; /* if window */
+	}; /* core::core() */
+
+	core::~core()
+	{
+	    if (timer)
+	    {
+		esp_timer_stop(timer);
+		esp_timer_delete(timer);
+	    }; /* if timer */
+	}; /* core::~core() */
+
+
+	///@brief request the delivery: post the event or arm the window timer
+	void core::request()
+	{
+	    if (!timer || esp_timer_start_once(timer, window) != ESP_OK)
+		post(this);
+	}; /* core::request() */
+
+
+#if CONFIG_ESP_EVENT_POST_FROM_ISR
+	///@brief request the delivery from the ISR: post the event immediately
+	void IRAM_ATTR core::request_from_isr(BaseType_t* woken)
+	{
+	    posting(loop? esp_event_isr_post_to(loop, ev_base, event, nullptr, 0, woken):
+		    esp_event_isr_post(ev_base, event, nullptr, 0, woken), true);
+	}; /* core::request_from_isr() */
+#endif	// CONFIG_ESP_EVENT_POST_FROM_ISR
+
+
+	///@brief post the event
+	void core::post(void* arg)
+	{
+	    core* self = static_cast<core*>(arg);
+
+	    self->posting(self->loop? esp_event_post_to(self->loop, self->ev_base, self->event, nullptr, 0, 0):
+		    esp_event_post(self->ev_base, self->event, nullptr, 0, 0), false);
+	}; /* core::post() */
+
+
+	///@brief account the result of the posting
+	void IRAM_ATTR core::posting(esp_err_t err, bool isr)
+	{
+	    enter(isr);
+	    if (err == ESP_OK)
+		posted++;
+	    else
+		// the loop queue is full: the next push will request the delivery again, the accumulated state is kept
+		pending = false;
+	    leave(isr);
+	}; /* core::posting() */
+
+    }; /* namespace coalesce */
+
+}; /* namespace event */
+
+
+//--[ event_coalesce.cpp ]---------------------------------------------------------------------------------------------
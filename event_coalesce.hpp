@@ -0,0 +1,348 @@
+/*!@file event_coalesce.hpp
+ *
+ * @brief Coalescing delivery of the high-frequency events: the producer pushes the payloads to the coalescer,
+ *	  only one event is posted while the previous is not handled, the handler receives the accumulated payloads
+ *	  by the one call: the latest value, the merged value or the batch of the values;
+ *	  the payloads are trivially copyable: the critical sections only copy them by the memcpy
+ *
+ * @note  Need pre-included including files esp_event.h & event_ctrl.hpp
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __EVENT_COALESCE_HPP__
+#define __EVENT_COALESCE_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <sdkconfig.h>
+#include <esp_timer.h>
+
+
+namespace event
+{
+    namespace coalesce
+    {
+
+	///@brief core of the coalescers: pending flag, posting of the event & the time window;
+	/// the coalescer is registered as the ordinary handler for it's own (loop, base, event)
+	class core: public handler::loop_base
+	{
+	public:
+
+	    ///@parameter [in] lp     - event loop; nullptr for the default system loop
+	    ///@parameter [in] window - batching time window, us: the event is posted after the window from the first push;
+	    ///				0 - post immediately
+	    core(esp_event_loop_handle_t lp, esp_event_base_t bas, int32_t ev, uint64_t window = 0);
+	    ~core();
+
+	    core(const core&) = delete;
+	    core& operator=(const core&) = delete;
+
+	    ///@brief count of the posted events
+	    uint32_t posts() const { return posted; };
+
+	    ///@brief count of the pushed payloads
+	    uint32_t pushes() const { return pushed; };
+
+	protected:
+
+	    ///@brief mark the delivery as pending, under the lock
+	    ///@return true if the delivery must be requested by the caller
+	    bool mark() {
+		pushed++;
+		return !std::exchange(pending, true); };
+
+	    ///@brief enter the critical section of the accumulated state, from the task or from the ISR
+	    void enter(bool isr) {
+		if (isr)
+		    portENTER_CRITICAL_ISR(&lock);
+		else
+		    portENTER_CRITICAL(&lock); };
+
+	    ///@brief exit the critical section of the accumulated state, from the task or from the ISR
+	    void leave(bool isr) {
+		if (isr)
+		    portEXIT_CRITICAL_ISR(&lock);
+		else
+		    portEXIT_CRITICAL(&lock); };
+
+	    ///@brief request the delivery: post the event or arm the window timer; outside of the lock
+	    void request();
+
+#if CONFIG_ESP_EVENT_POST_FROM_ISR
+	    ///@brief request the delivery from the ISR: post the event immediately, the window is not applied
+	    ///@parameter [out] woken - set to pdTRUE if the task with priority higher than the interrupted task was unblocked
+	    void request_from_isr(BaseType_t* woken);
+#endif	// CONFIG_ESP_EVENT_POST_FROM_ISR
+
+	    ///@brief post the event
+	    static void post(void* arg);
+
+	    ///@brief account the result of the posting: clear the pending flag if the event was not posted
+	    void posting(esp_err_t err, bool isr);
+
+	    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;	///< guard of the accumulated state
+	    bool pending = false;				///< the event is posted & not handled still
+	    uint32_t posted = 0;				///< count of the posted events
+	    uint32_t pushed = 0;				///< count of the pushed payloads
+	    const uint64_t window;				///< batching time window, us
+	    esp_timer_handle_t timer = nullptr;			///< window timer
+
+	}; /* core */
+
+
+
+	///@brief "latest wins" coalescer: the handler receives the last pushed value & the count of the overwritten ones
+	template <typename T>
+	class latest: public core
+	{
+	    static_assert(std::is_trivially_copyable_v<T>, "the payload of the event::coalesce::latest is copied by the memcpy");
+
+	public:
+
+	    using core::core;
+
+	    ///@brief push the value
+	    void push(const T& v) {
+		if (store(v, false))
+		    request(); };
+
+#if CONFIG_ESP_EVENT_POST_FROM_ISR
+	    ///@brief push the value from the ISR
+	    ///@parameter [out] woken - set to pdTRUE if the task with priority higher than the interrupted task was unblocked
+	    void push_from_isr(const T& v, BaseType_t* woken) {
+		if (store(v, true))
+		    request_from_isr(woken); };
+#endif	// CONFIG_ESP_EVENT_POST_FROM_ISR
+
+	    void instance_handler(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data) override final
+	    {
+		T v;
+		uint32_t drops;
+
+		portENTER_CRITICAL(&lock);
+		std::memcpy(&v, &value, sizeof(T));
+		drops = std::exchange(dropped, 0);
+		pending = false;
+		portEXIT_CRITICAL(&lock);
+		receive(v, drops);
+	    }; /* instance_handler() */
+
+	protected:
+
+	    ///@brief receive the last value
+	    ///@parameter [in] dropped - count of the overwritten values before it
+	    virtual void receive(const T& v, uint32_t dropped) = 0;
+
+	    ///@brief store the value
+	    ///@return true if the delivery must be requested
+	    bool store(const T& v, bool isr)
+	    {
+		bool req;
+
+		enter(isr);
+		if (pending)
+		    dropped++;
+		std::memcpy(&value, &v, sizeof(T));
+		req = mark();
+		leave(isr);
+		return req;
+	    }; /* store() */
+
+	    T value {};		///< last pushed value
+	    uint32_t dropped = 0;	///< count of the overwritten values
+
+	}; /* latest */
+
+
+
+	///@brief "count & merge" coalescer: the handler receives the merged value & the count of the merged ones;
+	/// the Merge is called outside of the critical section on the copy of the accumulated value,
+	/// the result is stored if no other push or delivery was between, else the merge is repeated
+	///@tparam Merge - merging functor: Merge()(accumulated, pushed) returns the new accumulated value;
+	///		   must be the ISR safe for the push_from_isr()
+	template <typename T, typename Merge = std::plus<T>>
+	class merge: public core
+	{
+	    static_assert(std::is_trivially_copyable_v<T>, "the payload of the event::coalesce::merge is copied by the memcpy");
+
+	public:
+
+	    using core::core;
+
+	    ///@brief push & merge the value
+	    void push(const T& v) {
+		if (store(v, false))
+		    request(); };
+
+#if CONFIG_ESP_EVENT_POST_FROM_ISR
+	    ///@brief push & merge the value from the ISR
+	    ///@parameter [out] woken - set to pdTRUE if the task with priority higher than the interrupted task was unblocked
+	    void push_from_isr(const T& v, BaseType_t* woken) {
+		if (store(v, true))
+		    request_from_isr(woken); };
+#endif	// CONFIG_ESP_EVENT_POST_FROM_ISR
+
+	    void instance_handler(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data) override final
+	    {
+		T v;
+		uint32_t n;
+
+		portENTER_CRITICAL(&lock);
+		std::memcpy(&v, &acc, sizeof(T));
+		n = std::exchange(count, 0);
+		generation++;
+		pending = false;
+		portEXIT_CRITICAL(&lock);
+		if (n)
+		    receive(v, n);
+	    }; /* instance_handler() */
+
+	protected:
+
+	    ///@brief receive the merged value
+	    ///@parameter [in] count - count of the merged values
+	    virtual void receive(const T& merged, uint32_t count) = 0;
+
+	    ///@brief merge the value to the accumulated one
+	    ///@return true if the delivery must be requested
+	    bool store(const T& v, bool isr)
+	    {
+		T m;
+		uint32_t gen, n;
+		bool req;
+
+		for (;;)
+		{
+		    enter(isr);
+		    gen = generation;
+		    n = count;
+		    std::memcpy(&m, &acc, sizeof(T));
+		    leave(isr);
+
+		    m = n? Merge()(m, v): v;
+
+		    enter(isr);
+		    if (gen == generation)
+			break;
+		    leave(isr);
+		}; /* for ;; */
+		std::memcpy(&acc, &m, sizeof(T));
+		count++;
+		generation++;
+		req = mark();
+		leave(isr);
+		return req;
+	    }; /* store() */
+
+	    T acc {};			///< accumulated value
+	    uint32_t count = 0;		///< count of the merged values
+	    uint32_t generation = 0;	///< changes count of the accumulated value, validates the merge outside of the lock
+
+	}; /* merge */
+
+
+
+	///@brief batching coalescer: the handler receives the span of the accumulated values;
+	/// double buffered - the producer fills one buffer while the handler reads the other
+	///@tparam N - capacity of the batch; the values above it are dropped & counted
+	template <typename T, size_t N>
+	class batch: public core
+	{
+	    static_assert(std::is_trivially_copyable_v<T>, "the payload of the event::coalesce::batch is copied by the memcpy");
+
+	public:
+
+	    using core::core;
+
+	    ///@brief push the value to the batch
+	    ///@return false if the batch is full & the value was dropped
+	    bool push(const T& v) {
+		    bool ok;
+
+		if (store(v, false, ok))
+		    request();
+		return ok; };
+
+#if CONFIG_ESP_EVENT_POST_FROM_ISR
+	    ///@brief push the value to the batch from the ISR
+	    ///@parameter [out] woken - set to pdTRUE if the task with priority higher than the interrupted task was unblocked
+	    ///@return false if the batch is full & the value was dropped
+	    bool push_from_isr(const T& v, BaseType_t* woken) {
+		    bool ok;
+
+		if (store(v, true, ok))
+		    request_from_isr(woken);
+		return ok; };
+#endif	// CONFIG_ESP_EVENT_POST_FROM_ISR
+
+	    void instance_handler(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data) override final
+	    {
+		unsigned idx;
+		size_t n;
+		uint32_t drops;
+
+		// the handler calls are serialized by the loop: the read buffer is not swapped again while received
+		portENTER_CRITICAL(&lock);
+		idx = active;
+		active ^= 1;
+		n = std::exchange(fill, 0);
+		drops = std::exchange(dropped, 0);
+		pending = false;
+		portEXIT_CRITICAL(&lock);
+		if (n || drops)
+		    receive(std::span<const T>(buf[idx], n), drops);
+	    }; /* instance_handler() */
+
+	    ///@brief capacity of the batch
+	    static constexpr size_t capacity() { return N; };
+
+	protected:
+
+	    ///@brief receive the batch of the values, in the push order
+	    ///@parameter [in] dropped - count of the values, dropped after the batch was full
+	    virtual void receive(std::span<const T> values, uint32_t dropped) = 0;
+
+	    ///@brief store the value to the active buffer
+	    ///@parameter [out] ok - the value was stored, not dropped
+	    ///@return true if the delivery must be requested
+	    bool store(const T& v, bool isr, bool& ok)
+	    {
+		bool req;
+
+		enter(isr);
+		ok = fill < N;
+		if (ok)
+		    std::memcpy(&buf[active][fill++], &v, sizeof(T));
+		else
+		    dropped++;
+		req = mark();
+		leave(isr);
+		return req;
+	    }; /* store() */
+
+	    T buf[2][N];		///< double buffer of the batches
+	    unsigned active = 0;	///< buffer, filled by the producer
+	    size_t fill = 0;		///< count of the values in the active buffer
+	    uint32_t dropped = 0;	///< count of the dropped values
+
+	}; /* batch */
+
+    }; /* namespace coalesce */
+
+}; /* namespace event */
+
+
+#endif /* __EVENT_COALESCE_HPP__ */
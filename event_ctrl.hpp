@@ -74,12 +74,37 @@ namespace event
 
 
 
+    namespace profile
+    {
+
+	///@brief no profiling: the default policy of the event::ctrl, zero overhead;
+	/// the profiling policies are in the opt-in event_profile.hpp
+	struct none
+	{
+	    struct token {};
+
+	    ///@brief begin of the handler dispatch: adjust the event data pointer
+	    token enter(void *&) { return {}; };
+
+	    ///@brief end of the handler dispatch
+	    void leave(token) {};
+
+	}; /* none */
+
+    }; /* namespace profile */
+
+
+
     ///@brief class for operating with event handlers witch explicit specification instance
     /// register or unregister handler & implement unique handler for each exemplar
     /// of the derived class from the event_handler_base;
-    template <auto &handler>
+    ///@tparam Profile - profiling policy of the handler dispatch: profile::none, profile::timed<> of the event_profile.hpp
+    template <auto &handler, typename Profile = profile::none>
     struct ctrl
     {
+	///@brief profiling data of the handler dispatch
+	static inline Profile profiling {};
+
 	///@brief Register event handler for default system loop
 	/// all register values are values from instance parameters of the handling event in the handler object
 	static esp_err_t enroll() {
@@ -109,7 +134,7 @@ namespace event
 	/// all register values are defined as procedure parameters, but default values is a stored values from instanceparameters of the handling event in the handler object
 	static esp_err_t enroll_to() {
 //	    return esp_event_handler_instance_register_with(handler.loop, handler.ev_base, handler.event, implement_handler, data, &instance); };
-	    return enroll_to(handler.loop, handler.ev_base, handler.event, handler.arg, &handler.instance); };
+	    return enroll_to(handler.loop, handler.ev_base, handler.event, handler.arg); };
 
 	///@brief Register event handler for specified loop
 	/// all register values are defined as procedure parameters, but default values is a stored values from instanceparameters of the handling event in the handler object
@@ -148,7 +173,7 @@ namespace event
 
 	///@brief Unregister event handler for default system loop & full stored parameters of the handling event in the handler object
 	static esp_err_t unreg_from(esp_event_loop_handle_t loop) {
-	    return unreg_from(loop, handler.ev_base, handler.event, handler.instance); };
+	    return unreg_from(loop, handler.ev_base, handler.event); };
 
 	///@brief Unregister event handler for default system loop & full stored parameters of the handling event in the handler object
 	static esp_err_t unreg_from(esp_event_base_t base, int32_t event) {
@@ -185,11 +210,13 @@ namespace event
 
     }; /* event::ctrl */
 
-    template <auto &handler>
-    void ctrl<handler>::implement_handler(void *arg, esp_event_base_t base,
+    template <auto &handler, typename Profile>
+    void ctrl<handler, Profile>::implement_handler(void *arg, esp_event_base_t base,
 					int32_t event, void *data) {
+	auto token = profiling.enter(data);
 	handler.instance_handler(arg, base, event, data);
-    }; /* event::ctrl<handler>::implement_handler() */
+	profiling.leave(token);
+    }; /* event::ctrl<handler, Profile>::implement_handler() */
 
 
 }; /* namespace event */
@@ -0,0 +1,172 @@
+/*!@file event_executor.hpp
+ *
+ * @brief Prioritized multi-loop event executor: owns the event loops with the distinct task priorities & cores,
+ *	  routes the handlers to the loop by the priority class, counts the posted & dispatched events per loop;
+ *	  the executor posts its events by the own private event base, only they are counted
+ *
+ * @note  Need pre-included including files esp_event.h & event_ctrl.hpp
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __EVENT_EXECUTOR_HPP__
+#define __EVENT_EXECUTOR_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace event
+{
+
+    ///@brief configuration of the one loop of the executor
+    struct loop_config
+    {
+	const char* name;		///< name of the loop task
+	UBaseType_t priority;		///< priority of the loop task
+	BaseType_t core = tskNO_AFFINITY;	///< core affinity of the loop task
+	int32_t queue = 32;		///< length of the loop queue
+	uint32_t stack = 3072;		///< stack size of the loop task
+    }; /* loop_config */
+
+
+    ///@brief statistics of the one loop of the executor
+    struct loop_stats
+    {
+	uint32_t posted;	///< count of the events, posted by the executor
+	uint32_t dispatched;	///< count of the events of the executor, taken by the loop to the dispatching
+	uint32_t failed;	///< count of the failed posts: the loop queue was full
+	int32_t capacity;	///< configured length of the loop queue
+
+	///@brief count of the events of the executor, waiting in the loop queue: the real depth of the queue,
+	/// if the events of the other bases are not posted to the loop directly
+	uint32_t backlog() const { return posted - dispatched; };
+    }; /* loop_stats */
+
+
+    ///@brief Prioritized multi-loop event executor; the events, posted by the executor, have the own event base
+    /// of the executor: event_base(), the handlers of them are registered for it. The events of the other bases,
+    /// posted to the loop(cls) directly, are dispatched as usual but are not counted by the stats()
+    ///@tparam N - count of the loops/priority classes; class 0 is the most urgent by convention
+    template <size_t N = 3>
+    class executor
+    {
+    public:
+
+	///@brief create the loops
+	///@parameter [in] cfg - configuration of the loops, by the priority classes
+	explicit executor(const std::array<loop_config, N>& cfg)
+	{
+	    for (size_t cls = 0; cls < N; cls++)
+	    {
+		const esp_event_loop_args_t args {
+		    .queue_size = cfg[cls].queue,
+		    .task_name = cfg[cls].name,
+		    .task_priority = cfg[cls].priority,
+		    .task_stack_size = cfg[cls].stack,
+		    .task_core_id = cfg[cls].core,
+		};
+		classes[cls].capacity = cfg[cls].queue;
+		if (esp_event_loop_create(&args, &classes[cls].loop) != ESP_OK)
+		{
+		    classes[cls].loop = nullptr;
+		    continue;
+		}; /* if esp_event_loop_create() != ESP_OK */
+		// the sentinel is called for the every event, posted by the executor, before the handlers of it
+		esp_event_handler_instance_register_with(classes[cls].loop, own_base, ESP_EVENT_ANY_ID,
+			sentinel, &classes[cls], &classes[cls].sentinel_instance);
+	    }; /* for cls < N */
+	}; /* executor() */
+
+	///@brief delete the loops
+	~executor()
+	{
+	    for (auto& c: classes)
+		if (c.loop)
+		    esp_event_loop_delete(c.loop);
+	}; /* ~executor() */
+
+	executor(const executor&) = delete;
+	executor& operator=(const executor&) = delete;
+
+	///@brief are all loops was created?
+	bool created() const
+	{
+	    for (auto& c: classes)
+		if (!c.loop)
+		    return false;
+	    return true;
+	}; /* created() */
+
+	///@brief loop of the priority class
+	esp_event_loop_handle_t loop(size_t cls) const { return classes[cls].loop; };
+
+	///@brief route the handler to the loop of the priority class
+	///@return the loop of the handler
+	esp_event_loop_handle_t route(handler::loop_base& h, size_t cls) { return h.loop = classes[cls].loop; };
+
+	///@brief route & register the handler to the loop of the priority class
+	template <auto &handler>
+	esp_err_t enroll(size_t cls) {
+	    route(handler, cls);
+	    return ctrl<handler>::enroll_to(); };
+
+	///@brief event base of the events, posted by the executor
+	static esp_event_base_t event_base() { return own_base; };
+
+	///@brief post the event of the executor event_base() to the loop of the priority class
+	esp_err_t post(size_t cls, int32_t id, const void* data = nullptr, size_t size = 0, TickType_t ticks = 0)
+	{
+	    auto& c = classes[cls];
+	    esp_err_t err = esp_event_post_to(c.loop, own_base, id, data, size, ticks);
+	    (err == ESP_OK? c.posted: c.failed).fetch_add(1, std::memory_order_relaxed);
+	    return err;
+	}; /* post() */
+
+	///@brief statistics of the loop of the priority class
+	loop_stats stats(size_t cls) const
+	{
+	    auto& c = classes[cls];
+	    // dispatched is read first: the backlog is never negative
+	    uint32_t dispatched = c.dispatched.load(std::memory_order_acquire);
+	    return {c.posted.load(std::memory_order_relaxed), dispatched, c.failed.load(std::memory_order_relaxed), c.capacity};
+	}; /* stats() */
+
+	///@brief count of the priority classes
+	static constexpr size_t size() { return N; };
+
+    protected:
+
+	///@brief the loop of the priority class with it's counters
+	struct loop_class
+	{
+	    esp_event_loop_handle_t loop = nullptr;			///< the loop
+	    esp_event_handler_instance_t sentinel_instance = nullptr;	///< registration of the sentinel handler
+	    std::atomic<uint32_t> posted {0};				///< count of the events, posted by the executor
+	    std::atomic<uint32_t> dispatched {0};			///< count of the events of the executor, dispatched by the loop
+	    std::atomic<uint32_t> failed {0};				///< count of the failed posts
+	    int32_t capacity = 0;					///< configured length of the loop queue
+	}; /* loop_class */
+
+	///@brief private event base of the executor: the address is unique, the name is for the logs only
+	static inline const char own_base[] = "event::executor";
+
+	///@brief sentinel handler: count the dispatched events of the executor
+	static void sentinel(void *arg, esp_event_base_t base, int32_t h_event, void *data) {
+	    static_cast<loop_class*>(arg)->dispatched.fetch_add(1, std::memory_order_release); };
+
+	std::array<loop_class, N> classes;	///< loops by the priority classes
+
+    }; /* event::executor */
+
+}; /* namespace event */
+
+
+#endif /* __EVENT_EXECUTOR_HPP__ */
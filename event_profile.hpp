@@ -0,0 +1,180 @@
+/*!@file event_profile.hpp
+ *
+ * @brief Profiling policies for the event::ctrl: per-handler execution time & post-to-dispatch latency
+ *	  in the lock-free log2 histograms, budget overrun counting; opt-in, the event_ctrl.hpp has
+ *	  the profile::none only
+ *
+ * @note  Need pre-included including file esp_event.h
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __EVENT_PROFILE_HPP__
+#define __EVENT_PROFILE_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <esp_timer.h>
+
+
+namespace event
+{
+    namespace profile
+    {
+
+	///@brief lock-free log2 histogram of the time intervals:
+	/// bin 0 - less than 1 us, bin i - [2^(i-1), 2^i) us, the last bin - all above
+	///@tparam Bins - count of the bins
+	template <size_t Bins = 16>
+	class histogram
+	{
+	public:
+
+	    static constexpr size_t bins = Bins;
+
+	    ///@brief count the interval
+	    ///@parameter [in] us - interval, us
+	    void add(uint32_t us) {
+		size_t bin = std::bit_width(us);
+		counts[bin < Bins? bin: Bins - 1].fetch_add(1, std::memory_order_relaxed); };
+
+	    ///@brief copy the counters of the bins
+	    void snapshot(std::span<uint32_t, Bins> out) const {
+		for (size_t i = 0; i < Bins; i++)
+		    out[i] = counts[i].load(std::memory_order_relaxed); };
+
+	    ///@brief clear the counters of the bins
+	    void reset() {
+		for (auto& cnt: counts)
+		    cnt.store(0, std::memory_order_relaxed); };
+
+	    ///@brief upper bound of the bin, us; 0 for the last, unbounded bin
+	    static constexpr uint32_t upper(size_t bin) {
+		return bin < Bins - 1? uint32_t(1) << bin: 0; };
+
+	protected:
+	    std::atomic<uint32_t> counts[Bins] {};	///< counters of the bins
+
+	}; /* histogram */
+
+
+	///@brief header of the stamped event payload: time of the post
+	template <typename T>
+	struct stamped
+	{
+	    static_assert(alignof(T) <= alignof(int64_t), "the stamped payload must not be overaligned");
+
+	    int64_t stamp;	///< time of the post, esp_timer_get_time(), us
+	    T body;		///< event payload
+	}; /* stamped */
+
+	template <>
+	struct stamped<void>
+	{
+	    int64_t stamp;	///< time of the post, esp_timer_get_time(), us
+	}; /* stamped<void> */
+
+	///@brief offset of the payload in the stamped event data
+	constexpr size_t stamp_size = sizeof(int64_t);
+
+
+	///@brief post the stamped event to the default loop: for the handlers with the latency profiling
+	template <typename T>
+	inline esp_err_t post(esp_event_base_t base, int32_t id, const T& payload, TickType_t ticks) {
+	    stamped<T> data {esp_timer_get_time(), payload};
+	    return esp_event_post(base, id, &data, sizeof(data), ticks); };
+
+	///@brief post the stamped event w/o payload to the default loop
+	inline esp_err_t post(esp_event_base_t base, int32_t id, TickType_t ticks) {
+	    stamped<void> data {esp_timer_get_time()};
+	    return esp_event_post(base, id, &data, sizeof(data), ticks); };
+
+	///@brief post the stamped event to the specified loop
+	template <typename T>
+	inline esp_err_t post_to(esp_event_loop_handle_t loop, esp_event_base_t base, int32_t id, const T& payload, TickType_t ticks) {
+	    stamped<T> data {esp_timer_get_time(), payload};
+	    return esp_event_post_to(loop, base, id, &data, sizeof(data), ticks); };
+
+	///@brief post the stamped event w/o payload to the specified loop
+	inline esp_err_t post_to(esp_event_loop_handle_t loop, esp_event_base_t base, int32_t id, TickType_t ticks) {
+	    stamped<void> data {esp_timer_get_time()};
+	    return esp_event_post_to(loop, base, id, &data, sizeof(data), ticks); };
+
+
+
+	///@brief execution time profiling of the handler, with the budget
+	///@tparam Budget  - execution time budget of the handler, us
+	///@tparam Stamped - all events of the handler are posted by the profile::post(): measure the post-to-dispatch latency
+	///@tparam Bins    - count of the histograms bins
+	template <uint32_t Budget = 1000, bool Stamped = false, size_t Bins = 16>
+	class timed
+	{
+	public:
+
+	    struct token { int64_t start; };
+
+	    ///@brief begin of the handler dispatch: count the latency & strip the stamp from the event data
+	    token enter(void *&data)
+	    {
+		int64_t now = esp_timer_get_time();
+
+		if constexpr (Stamped)
+		{
+		    latency.add(static_cast<uint32_t>(now - static_cast<const stamped<void>*>(data)->stamp));
+		    data = static_cast<uint8_t*>(data) + stamp_size;
+		}; /* if constexpr Stamped */
+		return {now};
+	    }; /* enter() */
+
+	    ///@brief end of the handler dispatch: count the execution time & the budget overrun
+	    void leave(token tk)
+	    {
+		uint32_t us = static_cast<uint32_t>(esp_timer_get_time() - tk.start);
+		uint32_t worst = max_exec.load(std::memory_order_relaxed);
+
+		exec.add(us);
+		if (us > Budget)
+		    overrun_cnt.fetch_add(1, std::memory_order_relaxed);
+		while (us > worst && !max_exec.compare_exchange_weak(worst, us, std::memory_order_relaxed));
+	    }; /* leave() */
+
+	    ///@brief execution time budget of the handler, us
+	    static constexpr uint32_t budget() { return Budget; };
+
+	    ///@brief count of the handler calls, exceeded the budget
+	    uint32_t overruns() const { return overrun_cnt.load(std::memory_order_relaxed); };
+
+	    ///@brief max execution time of the handler, us
+	    uint32_t worst() const { return max_exec.load(std::memory_order_relaxed); };
+
+	    ///@brief clear the histograms & counters
+	    void reset() {
+		exec.reset();
+		latency.reset();
+		overrun_cnt.store(0, std::memory_order_relaxed);
+		max_exec.store(0, std::memory_order_relaxed); };
+
+	    histogram<Bins> exec;		///< execution time of the handler
+	    histogram<Bins> latency;		///< post-to-dispatch latency; stamped events only
+
+	protected:
+	    std::atomic<uint32_t> overrun_cnt {0};	///< count of the handler calls, exceeded the budget
+	    std::atomic<uint32_t> max_exec {0};		///< max execution time of the handler, us
+
+	}; /* timed */
+
+    }; /* namespace profile */
+
+}; /* namespace event */
+
+
+#endif /* __EVENT_PROFILE_HPP__ */
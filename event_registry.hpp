@@ -0,0 +1,222 @@
+/*!@file event_registry.hpp
+ *
+ * @brief Runtime registry of the event handlers: any handler::base object, also created at runtime,
+ *	  is registered through the one shared trampoline, w/o the template instantiation per handler
+ *
+ * @note  Need pre-included including files esp_event.h & event_ctrl.hpp
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __EVENT_REGISTRY_HPP__
+#define __EVENT_REGISTRY_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+
+namespace event
+{
+
+    ///@brief Runtime registry of the event handlers with the fixed capacity:
+    /// the registration argument is the handler object itself, the registrations are stored in the slots array,
+    /// unregistration by the token is O(1)
+    ///@tparam N - capacity of the registry, count of the simultaneous registrations
+    template <size_t N = 16>
+    class registry
+    {
+	static_assert(N > 0 && N < std::numeric_limits<uint16_t>::max(), "capacity of the event::registry is out of range");
+
+	static constexpr uint16_t none = std::numeric_limits<uint16_t>::max();	///< no slot
+
+    public:
+
+	registry()
+	{
+	    for (uint16_t i = 0; i < N; i++)
+		slots[i].next = size_t(i) + 1 < N? i + 1: none;
+	}; /* registry() */
+
+	///@brief unregister all remaining registrations
+	~registry()
+	{
+	    for (uint16_t i = 0; i < N; i++)
+		if (slots[i].target)
+		    unreg(i);
+	}; /* ~registry() */
+
+	registry(const registry&) = delete;
+	registry& operator=(const registry&) = delete;
+
+
+	///@brief registration token: unregister the handler at destroy
+	class token
+	{
+	public:
+	    token(): reg(nullptr), slot(none), err(ESP_ERR_INVALID_STATE) {};
+	    token(token&& other): reg(std::exchange(other.reg, nullptr)), slot(std::exchange(other.slot, none)), err(other.err) {};
+	    token& operator=(token&& other) {
+		if (this != &other)
+		{
+		    unreg();
+		    reg = std::exchange(other.reg, nullptr);
+		    slot = std::exchange(other.slot, none);
+		    err = other.err;
+		}; /* if this != &other */
+		return *this; };
+	    ~token() { unreg(); };
+
+	    ///@brief unregister the handler
+	    esp_err_t unreg() {
+		return reg? std::exchange(reg, nullptr)->unreg(std::exchange(slot, none)): ESP_ERR_INVALID_STATE; };
+
+	    ///@brief detach the token from the registration: the handler stay registered up to the registry destroy
+	    void release() { reg = nullptr; slot = none; };
+
+	    ///@brief is the handler registered?
+	    explicit operator bool() const { return reg != nullptr; };
+
+	    ///@brief registration error code
+	    esp_err_t error() const { return err; };
+
+	protected:
+	    friend class registry;
+	    token(registry* r, uint16_t s, esp_err_t e): reg(r), slot(s), err(e) {};
+
+	    registry* reg;	///< owner of the registration
+	    uint16_t slot;	///< slot of the registration
+	    esp_err_t err;	///< registration error code
+	}; /* token */
+
+
+	///@brief Register event handler for default system loop, to the event, stored in the handler object
+	token enroll(handler::base& h) {
+	    return enroll_to(nullptr, h, h.ev_base, h.event); };
+
+	///@brief Register event handler for default system loop
+	token enroll(handler::base& h, esp_event_base_t base, int32_t event) {
+	    return enroll_to(nullptr, h, base, event); };
+
+	///@brief Register event handler for the handler own loop
+	token enroll_to(handler::loop_base& h) {
+	    return enroll_to(h.loop, h, h.ev_base, h.event); };
+
+	///@brief Register event handler for specified loop, to the event, stored in the handler object
+	token enroll_to(esp_event_loop_handle_t loop, handler::base& h) {
+	    return enroll_to(loop, h, h.ev_base, h.event); };
+
+	///@brief Register event handler for specified loop; nullptr loop is the default system loop
+	token enroll_to(esp_event_loop_handle_t loop, handler::base& h, esp_event_base_t base, int32_t event)
+	{
+		uint16_t i;
+		esp_err_t err;
+
+	    portENTER_CRITICAL(&lock);
+	    i = free_head;
+	    if (i != none)
+	    {
+		free_head = slots[i].next;
+		used++;
+	    }; /* if i != none */
+	    portEXIT_CRITICAL(&lock);
+
+	    if (i == none)
+		return token(nullptr, none, ESP_ERR_NO_MEM);
+
+	    entry& e = slots[i];
+	    e.loop = loop;
+	    e.base = base;
+	    e.event = event;
+	    err = loop? esp_event_handler_instance_register_with(loop, base, event, trampoline, &h, &e.instance):
+		    esp_event_handler_instance_register(base, event, trampoline, &h, &e.instance);
+	    if (err != ESP_OK)
+	    {
+		release(i);
+		return token(nullptr, none, err);
+	    }; /* if err != ESP_OK */
+	    e.target = &h;
+	    return token(this, i, ESP_OK);
+	}; /* enroll_to() */
+
+
+	///@brief automatically control for the event hadlers: register event handler at the create object and unregister it at destroy
+	struct automatic
+	{
+	    automatic(registry& r, handler::base& h, bool reg = false): owner(r), handle_ref(h) { if (reg) enroll(); };
+
+	    esp_err_t enroll() { reg = owner.enroll(handle_ref); return reg.error(); };
+	    esp_err_t unreg()  { return reg.unreg(); };
+
+	    registry& owner;
+	    handler::base& handle_ref;
+
+	protected:
+	    token reg;
+
+	}; /* struct automatic */
+
+
+	///@brief count of the registrations
+	size_t size() const { return used; };
+
+	///@brief capacity of the registry
+	static constexpr size_t capacity() { return N; };
+
+    protected:
+
+	///@brief registration slot; the free slots are linked to the list by the next index
+	struct entry
+	{
+	    handler::base* target = nullptr;			///< registered handler, nullptr for the free slot
+	    esp_event_loop_handle_t loop = nullptr;		///< loop of the registration, nullptr - default system loop
+	    esp_event_base_t base = nullptr;			///< event base of the registration
+	    int32_t event = 0;					///< event id of the registration
+	    esp_event_handler_instance_t instance = nullptr;	///< registration instance
+	    uint16_t next = none;				///< next free slot
+	}; /* entry */
+
+	///@brief unregister the handler in the slot & free the slot
+	esp_err_t unreg(uint16_t i)
+	{
+	    entry& e = slots[i];
+	    esp_err_t err = e.loop? esp_event_handler_instance_unregister_with(e.loop, e.base, e.event, e.instance):
+		    esp_event_handler_instance_unregister(e.base, e.event, e.instance);
+	    e.target = nullptr;
+	    e.instance = nullptr;
+	    release(i);
+	    return err;
+	}; /* unreg() */
+
+	///@brief return the slot to the free list
+	void release(uint16_t i)
+	{
+	    portENTER_CRITICAL(&lock);
+	    slots[i].next = free_head;
+	    free_head = i;
+	    used--;
+	    portEXIT_CRITICAL(&lock);
+	}; /* release() */
+
+	///@brief common trampoline for all handlers: registration argument is the handler object
+	static void trampoline(void *arg, esp_event_base_t base, int32_t h_event, void *data) {
+	    handler::base* h = static_cast<handler::base*>(arg);
+	    h->instance_handler(h->arg, base, h_event, data); };
+
+	entry slots[N];						///< registration slots
+	uint16_t free_head = 0;					///< first free slot
+	size_t used = 0;					///< count of the registrations
+	portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;	///< guard of the free list
+
+    }; /* event::registry */
+
+}; /* namespace event */
+
+
+#endif /* __EVENT_REGISTRY_HPP__ */
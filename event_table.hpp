@@ -0,0 +1,169 @@
+/*!@file event_table.hpp
+ *
+ * @brief Static dispatch table for the set of event handler objects: one registration per event base,
+ *	  fan out to the handlers w/o virtual calls, header template file
+ *
+ * @note  Need pre-included including file esp_event.h
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __EVENT_TABLE_HPP__
+#define __EVENT_TABLE_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <type_traits>
+
+
+namespace event
+{
+
+    ///@brief static dispatch table for the set of handler objects with static storage (e.g. derived from the handler::base);
+    /// the handlers are grouped by the event base & sorted by the event id at the enroll time,
+    /// the one trampoline is registered per event base, it calls the matched handlers directly - w/o virtual dispatch
+    template <auto&... handlers>
+    struct table
+    {
+	static_assert(sizeof...(handlers) > 0, "event::table must contain at least one handler");
+
+	///@brief count of the handlers in the table
+	static constexpr size_t size = sizeof...(handlers);
+
+	///@brief Register the table for default system loop
+	static esp_err_t enroll() {
+	    return enroll_to(nullptr); };
+
+	///@brief Register the table for specified loop; nullptr - the default system loop
+	///@return ESP_ERR_INVALID_STATE if the table is registered already: unreg() it first
+	static esp_err_t enroll_to(esp_event_loop_handle_t lp)
+	{
+		esp_err_t err = ESP_OK;
+
+	    // the rebuild would lose the registered instances
+	    if (enrolled())
+		return ESP_ERR_INVALID_STATE;
+
+	    build();
+	    loop = lp;
+	    for (size_t i = 0; i < groups_cnt && err == ESP_OK; i++)
+		err = (loop == nullptr)?
+			esp_event_handler_instance_register(groups[i].base, ESP_EVENT_ANY_ID, trampoline, &groups[i], &groups[i].instance):
+			esp_event_handler_instance_register_with(loop, groups[i].base, ESP_EVENT_ANY_ID, trampoline, &groups[i], &groups[i].instance);
+	    if (err != ESP_OK)
+		unreg();
+	    return err;
+	}; /* enroll_to() */
+
+	///@brief Unregister the table from the loop, where it was registered
+	static esp_err_t unreg()
+	{
+		esp_err_t err = ESP_OK;
+
+	    for (size_t i = 0; i < groups_cnt; i++)
+		if (groups[i].instance != nullptr)
+		{
+			esp_err_t res = (loop == nullptr)?
+				esp_event_handler_instance_unregister(groups[i].base, ESP_EVENT_ANY_ID, groups[i].instance):
+				esp_event_handler_instance_unregister_with(loop, groups[i].base, ESP_EVENT_ANY_ID, groups[i].instance);
+
+		    if (err == ESP_OK)
+			err = res;
+		    groups[i].instance = nullptr;
+		}; /* if groups[i].instance != nullptr */
+	    return err;
+	}; /* unreg() */
+
+	///@brief is the table registered to the loop?
+	static bool enrolled() {
+	    return std::any_of(groups.begin(), groups.begin() + groups_cnt, [](const group& g) { return g.instance != nullptr; }); };
+
+	///@brief automatically control for the table: register it at the create object and unregister it at destroy
+	struct automatic
+	{
+	    automatic(bool reg = false): registered(reg) {if (reg) table::enroll(); };
+	    ~automatic() { if (registered) table::unreg(); };
+
+	    esp_err_t enroll() { registered = true; return table::enroll(); };
+	    esp_err_t unreg()  { registered = false; return table::unreg(); };
+
+	protected:
+	    bool registered;
+
+	}; /* struct automatic */
+
+    protected:
+
+	///@brief direct call of the handler procedure
+	using call_t = void (*)(esp_event_base_t base, int32_t event, void* data);
+
+	///@brief entry of the dispatch table
+	struct entry
+	{
+	    esp_event_base_t base;
+	    int32_t event;
+	    call_t call;
+	}; /* entry */
+
+	///@brief entries with the same event base, registered with the one trampoline
+	struct group
+	{
+	    esp_event_base_t base;
+	    const entry* begin;
+	    const entry* end;
+	    esp_event_handler_instance_t instance = nullptr;
+	}; /* group */
+
+	///@brief call the handler w/o virtual dispatch
+	template <auto& handler>
+	static void call(esp_event_base_t base, int32_t event, void* data) {
+	    using handler_t = std::remove_reference_t<decltype(handler)>;
+	    handler.handler_t::instance_handler(handler.arg, base, event, data); };
+
+	///@brief fill the entries by the current event base & id of the handlers, sort it & group by the event base
+	static void build()
+	{
+	    entries = {entry{handlers.ev_base, static_cast<int32_t>(handlers.event), call<handlers>}...};
+	    std::stable_sort(entries.begin(), entries.end(), [](const entry& a, const entry& b) {
+		return std::less<const void*>()(a.base, b.base) || (a.base == b.base && a.event < b.event); });
+
+	    groups_cnt = 0;
+	    for (const entry& e: entries)
+		if (groups_cnt == 0 || groups[groups_cnt - 1].base != e.base)
+		    groups[groups_cnt++] = group{e.base, &e, &e + 1};
+		else
+		    groups[groups_cnt - 1].end = &e + 1;
+	}; /* build() */
+
+	///@brief the one registered handler procedure for the group: call handlers, matched with the event id
+	static void trampoline(void *arg, esp_event_base_t base, int32_t event, void *data)
+	{
+		const group& grp = *static_cast<const group*>(arg);
+		const entry* e = grp.begin;
+
+	    // ESP_EVENT_ANY_ID (-1) handlers are sorted first
+	    for (; e != grp.end && e->event == ESP_EVENT_ANY_ID; e++)
+		e->call(base, event, data);
+
+	    for (e = std::lower_bound(e, grp.end, event, [](const entry& en, int32_t ev) { return en.event < ev; });
+		    e != grp.end && e->event == event; e++)
+		e->call(base, event, data);
+	}; /* trampoline() */
+
+	static inline std::array<entry, size> entries {};
+	static inline std::array<group, size> groups {};
+	static inline size_t groups_cnt = 0;
+	static inline esp_event_loop_handle_t loop = nullptr;
+
+    }; /* event::table */
+
+}; /* namespace event */
+
+
+#endif /* __EVENT_TABLE_HPP__ */
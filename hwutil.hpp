@@ -0,0 +1,50 @@
+/*!@file hwutil.hpp
+ *
+ * @brief Hardware-dependent constants & helpers for the lock-free structures
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __HWUTIL_HPP__
+#define __HWUTIL_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <cstddef>
+
+
+namespace aso
+{
+    namespace hw
+    {
+
+	///@brief size of the cache line: separate data, modified by different cores, to the different lines
+#if defined(__XTENSA__) || defined(__riscv)
+	constexpr size_t cache_line = 32;
+#else
+	constexpr size_t cache_line = 64;
+#endif
+
+	///@brief CPU relax hint for the spin-wait loops: let the other hardware thread/core go ahead
+	inline void relax()
+	{
+#if defined(__XTENSA__) || defined(__riscv)
+	    __asm__ __volatile__ ("nop");
+#elif defined(__i386__) || defined(__x86_64__)
+	    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+	    __asm__ __volatile__ ("yield");
+#else
+	    __asm__ __volatile__ ("" ::: "memory");
+#endif
+	}; /* relax() */
+
+    }; /* namespace hw */
+
+}; /* namespace aso */
+
+
+#endif /* __HWUTIL_HPP__ */
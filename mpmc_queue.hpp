@@ -0,0 +1,176 @@
+/*!@file mpmc_queue.hpp
+ *
+ * @brief Bounded lock-free multi-producer/multi-consumer queue with the per-slot sequence numbers
+ *	  (D. Vyukov's algorithm), header template file;
+ *	  aso::blocking<mpmc_queue<T, N>> adds the waiting push_wait()/pop_wait()
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __MPMC_QUEUE_HPP__
+#define __MPMC_QUEUE_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "hwutil.hpp"
+
+
+namespace aso
+{
+
+    ///@brief Base of the bounded lock-free multi-producer/multi-consumer queue;
+    /// push() & pop() may be called from any tasks simultaneously
+    ///@tparam T - type of the items, must be default constructible & move assignable
+    ///@tparam N - capacity of the queue, power of 2
+    template <typename T, size_t N>
+    class mpmc_queue_base
+    {
+	static_assert(N > 1 && (N & (N - 1)) == 0, "capacity of the mpmc_queue must be a power of 2");
+
+    public:
+
+	///@brief slot of the queue: the sequence number tells the slot state to the producers & consumers
+	struct cell
+	{
+	    std::atomic<size_t> seq;	///< pos - free for the push at pos, pos + 1 - filled for the pop at pos
+	    T data;			///< the item
+	}; /* cell */
+
+	mpmc_queue_base(const mpmc_queue_base&) = delete;
+	mpmc_queue_base& operator=(const mpmc_queue_base&) = delete;
+
+	///@brief push the copy of the item to the queue
+	///@return false if the queue is full
+	bool push(const T& item) { return put([&](T& slot) { slot = item; }); };
+
+	///@brief move the item to the queue; item is not touched if the queue is full
+	///@return false if the queue is full
+	bool push(T&& item) { return put([&](T& slot) { slot = std::move(item); }); };
+
+	///@brief pop the item from the queue
+	///@return false if the queue is empty
+	bool pop(T& item)
+	{
+		cell* c;
+		size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+
+	    for (;;)
+	    {
+		c = &cells[pos & (N - 1)];
+		intptr_t diff = static_cast<intptr_t>(c->seq.load(std::memory_order_acquire)) - static_cast<intptr_t>(pos + 1);
+		if (diff == 0)
+		{
+		    if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			break;
+		} /* if diff == 0 */
+		else if (diff < 0)
+		    return false;
+		else
+		    pos = dequeue_pos.load(std::memory_order_relaxed);
+	    }; /* for (;;) */
+
+	    item = std::move(c->data);
+	    // free the slot for the push of the next round
+	    c->seq.store(pos + N, std::memory_order_release);
+	    return true;
+	}; /* pop() */
+
+	///@brief approximate count of the items in the queue
+	size_t size() const {
+	    size_t head = dequeue_pos.load(std::memory_order_acquire);
+	    size_t tail = enqueue_pos.load(std::memory_order_acquire);
+	    return tail > head? (tail - head < N? tail - head: N): 0; };
+
+	///@brief is the queue empty? approximate
+	bool empty() const { return size() == 0; };
+
+	///@brief is the queue full? approximate
+	bool full() const { return size() == N; };
+
+	///@brief capacity of the queue
+	static constexpr size_t capacity() { return N; };
+
+    protected:
+
+	explicit mpmc_queue_base(cell* storage): cells(storage) {};
+
+	///@brief initialize the sequence numbers of the slots; after the storage is constructed
+	void init()
+	{
+	    for (size_t i = 0; i < N; i++)
+		cells[i].seq.store(i, std::memory_order_relaxed);
+	    std::atomic_thread_fence(std::memory_order_release);
+	}; /* init() */
+
+	///@brief put the item to the reserved slot by the writer procedure
+	template <typename Writer>
+	bool put(Writer&& write)
+	{
+		cell* c;
+		size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+
+	    for (;;)
+	    {
+		c = &cells[pos & (N - 1)];
+		intptr_t diff = static_cast<intptr_t>(c->seq.load(std::memory_order_acquire)) - static_cast<intptr_t>(pos);
+		if (diff == 0)
+		{
+		    if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			break;
+		} /* if diff == 0 */
+		else if (diff < 0)
+		    return false;
+		else
+		    pos = enqueue_pos.load(std::memory_order_relaxed);
+	    }; /* for (;;) */
+
+	    write(c->data);
+	    // publish the slot for the pop
+	    c->seq.store(pos + 1, std::memory_order_release);
+	    return true;
+	}; /* put() */
+
+	cell* const cells;		///< storage of the items
+
+	alignas(hw::cache_line) std::atomic<size_t> enqueue_pos {0};	///< push position, shared by the producers
+	alignas(hw::cache_line) std::atomic<size_t> dequeue_pos {0};	///< pop position, shared by the consumers
+
+    }; /* aso::mpmc_queue_base */
+
+
+
+    ///@brief bounded lock-free multi-producer/multi-consumer queue with the storage in the heap
+    template <typename T, size_t N>
+    class mpmc_queue: public mpmc_queue_base<T, N>
+    {
+	using base = mpmc_queue_base<T, N>;
+
+    public:
+	mpmc_queue(): base(new typename base::cell[N]) { base::init(); };
+	~mpmc_queue() { delete[] this->cells; };
+
+	///@brief bounded lock-free multi-producer/multi-consumer queue with the static storage
+	class stat: public mpmc_queue_base<T, N>
+	{
+	public:
+	    stat(): base(body) { base::init(); };
+
+	protected:
+	    typename base::cell body[N];	///< storage of the items
+
+	}; /* aso::mpmc_queue::stat */
+
+    }; /* aso::mpmc_queue */
+
+}; /* namespace aso */
+
+
+#endif /* __MPMC_QUEUE_HPP__ */
@@ -0,0 +1,105 @@
+/*!@file pool.cpp
+ *
+ * @brief Fixed-block memory pool: O(1) allocation & free w/o heap fragmentation,
+ *	  implementation C++ body file
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <freertos/FreeRTOS.h>
+
+#include <esp_attr.h>
+
+#include "pool.hpp"
+
+
+
+//--[ class aso::pool_resource ]---------------------------------------------------------------------------------------
+
+
+///@brief create the pool of count blocks of the block bytes each, the storage is allocated in the heap
+aso::pool_resource::pool_resource(size_t block, size_t count, size_t align, std::pmr::memory_resource* upstream):
+	arena(static_cast<std::byte*>(::operator new(round(block, align) * count, std::align_val_t(aligned(align)), std::nothrow))),
+	block(round(block, align)), count(arena? count: 0), align(aligned(align)), owned(true), upstream(upstream)
+{
+    init();
+}; /* aso::pool_resource::pool_resource(size_t, size_t, size_t, std::pmr::memory_resource*) */
+
+///@brief create the pool upon the external storage
+aso::pool_resource::pool_resource(std::byte* storage, size_t block, size_t count, size_t align, std::pmr::memory_resource* upstream):
+	arena(storage), block(round(block, align)), count(count), align(aligned(align)), owned(false), upstream(upstream)
+{
+    init();
+}; /* aso::pool_resource::pool_resource(std::byte*, size_t, size_t, size_t, std::pmr::memory_resource*) */
+
+aso::pool_resource::~pool_resource()
+{
+    if (owned)
+	::operator delete(arena, std::align_val_t(align));
+}; /* aso::pool_resource::~pool_resource() */
+
+
+///@brief build the free list through the all blocks
+void aso::pool_resource::init()
+{
+    configASSERT((align & (align - 1)) == 0);
+    for (size_t i = count; i > 0; i--)
+    {
+	    node* n = reinterpret_cast<node*>(arena + (i - 1) * block);
+
+	n->next = free_list;
+	free_list = n;
+    }; /* for i > 0 */
+    free_cnt = count;
+}; /* aso::pool_resource::init() */
+
+
+///@brief take the block from the pool
+void* IRAM_ATTR aso::pool_resource::allocate_block()
+{
+	node* n;
+
+    portENTER_CRITICAL_SAFE(&lock);
+    n = free_list;
+    if (n != nullptr)
+    {
+	free_list = n->next;
+	free_cnt--;
+    }; /* if n != nullptr */
+    portEXIT_CRITICAL_SAFE(&lock);
+
+    return n;
+}; /* aso::pool_resource::allocate_block() */
+
+///@brief return the block to the pool
+void IRAM_ATTR aso::pool_resource::free_block(void* ptr)
+{
+	node* n = static_cast<node*>(ptr);
+
+    portENTER_CRITICAL_SAFE(&lock);
+    n->next = free_list;
+    free_list = n;
+    free_cnt++;
+    portEXIT_CRITICAL_SAFE(&lock);
+}; /* aso::pool_resource::free_block() */
+
+
+void* aso::pool_resource::do_allocate(size_t bytes, size_t alignment)
+{
+    if (bytes <= block && alignment <= align)
+	if (void* ptr = allocate_block(); ptr != nullptr)
+	    return ptr;
+    return upstream->allocate(bytes, alignment);
+}; /* aso::pool_resource::do_allocate() */
+
+void aso::pool_resource::do_deallocate(void* ptr, size_t bytes, size_t alignment)
+{
+    if (owns(ptr))
+	free_block(ptr);
+    else
+	upstream->deallocate(ptr, bytes, alignment);
+}; /* aso::pool_resource::do_deallocate() */
+
+
+//--[ pool.cpp ]-------------------------------------------------------------------------------------------------------
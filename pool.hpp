@@ -0,0 +1,196 @@
+/*!@file pool.hpp
+ *
+ * @brief Fixed-block memory pool: O(1) allocation & free w/o heap fragmentation,
+ *	  also usable as the std::pmr::memory_resource
+ *
+ * @note  Need pre-included including file freertos/FreeRTOS.h
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __POOL_HPP__
+#define __POOL_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+
+namespace aso
+{
+
+    ///@brief Fixed-block memory pool with the storage in the heap (allocated once, at the creation);
+    /// alloc & free of the block are O(1) from the free list, guarded by the critical section - callable from ISR;
+    /// as the std::pmr::memory_resource it passes requests, that do not fit the block or when pool is exhausted, to the upstream
+    class pool_resource: public std::pmr::memory_resource
+    {
+    public:
+
+	///@brief create the pool of count blocks of the block bytes each
+	///@parameter [in] block    - size of the block, rounded up to the align
+	///@parameter [in] count    - count of the blocks
+	///@parameter [in] align    - alignment of the blocks, a power of two; not less than the alignment of the free list node
+	///@parameter [in] upstream - resource for the requests, that can't be served by the pool
+	pool_resource(size_t block, size_t count, size_t align = alignof(std::max_align_t),
+		std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+	~pool_resource();
+
+	pool_resource(const pool_resource&) = delete;
+	pool_resource& operator=(const pool_resource&) = delete;
+
+	///@brief take the block from the pool
+	///@return the block or nullptr if pool is exhausted
+	void* allocate_block();
+
+	///@brief return the block to the pool
+	void free_block(void* ptr);
+
+	///@brief create the object in the block of the pool
+	///@return the object or nullptr if pool is exhausted
+	template <typename T, typename... Args>
+	T* make(Args&&... args)
+	{
+	    if (sizeof(T) > block || alignof(T) > align)
+		return nullptr;
+
+	    void* ptr = allocate_block();
+	    return (ptr != nullptr)? new (ptr) T(std::forward<Args>(args)...): nullptr;
+	}; /* make() */
+
+	///@brief destroy the object, created by the make(), & return it's block to the pool
+	template <typename T>
+	void destroy(T* obj)
+	{
+	    if (obj == nullptr)
+		return;
+	    obj->~T();
+	    free_block(obj);
+	}; /* destroy() */
+
+	///@brief is the pointer belongs to the pool storage?
+	bool owns(const void* ptr) const {
+	    return ptr >= arena && ptr < arena + block * count; };
+
+	///@brief size of the block
+	size_t block_size() const { return block; };
+
+	///@brief count of the blocks in the pool
+	size_t capacity() const { return count; };
+
+	///@brief count of the free blocks in the pool
+	size_t available() const { return free_cnt; };
+
+
+	///@brief Fixed-block memory pool with the static storage: Count blocks of the Block bytes, aligned to Align
+	template <size_t Block, size_t Count, size_t Align = alignof(std::max_align_t)>
+	class stat;
+
+    protected:
+
+	///@brief create the pool upon the external storage
+	pool_resource(std::byte* storage, size_t block, size_t count, size_t align, std::pmr::memory_resource* upstream);
+
+	void* do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; };
+
+	///@brief build the free list through the all blocks
+	void init();
+
+	///@brief node of the free list, placed in the free block
+	struct node
+	{
+	    node* next;
+	}; /* node */
+
+	///@brief the blocks alignment, sufficient for the free list node
+	static constexpr size_t aligned(size_t align) { return std::max(align, alignof(node)); };
+
+	///@brief the block size, sufficient for the free list node & rounded to the alignment
+	static constexpr size_t round(size_t block, size_t align) {
+	    return (std::max(block, sizeof(node)) + aligned(align) - 1) / aligned(align) * aligned(align); };
+
+	std::byte* const arena;		///< storage of the blocks
+	const size_t block;		///< size of the block
+	const size_t count;		///< count of the blocks
+	const size_t align;		///< alignment of the blocks
+	const bool owned;		///< the storage is allocated by the pool
+	std::pmr::memory_resource* const upstream;
+	node* free_list = nullptr;	///< list of the free blocks
+	size_t free_cnt = 0;		///< count of the free blocks
+	portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    }; /* aso::pool_resource */
+
+
+    ///@brief Fixed-block memory pool with the static storage
+    template <size_t Block, size_t Count, size_t Align>
+    class pool_resource::stat: public pool_resource
+    {
+	static_assert(Align != 0 && (Align & (Align - 1)) == 0, "aso::pool_resource::stat: Align must be a power of two");
+	static_assert(aligned(Align) % alignof(node) == 0, "aso::pool_resource::stat: blocks must be aligned for the free list node");
+
+    public:
+	explicit stat(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()):
+	    pool_resource(body, Block, Count, Align, upstream) {};
+
+    protected:
+	alignas(aligned(Align)) std::byte body[round(Block, Align) * Count];	///< storage of the blocks
+
+    }; /* aso::pool_resource::stat */
+
+
+
+    ///@brief typed pool of N objects of the type T, with the storage in the heap (allocated once, at the creation)
+    template <typename T, size_t N>
+    class pool: public pool_resource
+    {
+    public:
+	explicit pool(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()):
+	    pool_resource(sizeof(T), N, alignof(T), upstream) {};
+
+	///@brief create the object in the pool; nullptr if pool is exhausted
+	template <typename... Args>
+	T* make(Args&&... args) { return pool_resource::make<T>(std::forward<Args>(args)...); };
+
+	///@brief typed pool of N objects of the type T with the static storage
+	class stat: public pool_resource::stat<sizeof(T), N, alignof(T)>
+	{
+	public:
+	    using pool_resource::stat<sizeof(T), N, alignof(T)>::stat;
+
+	    ///@brief create the object in the pool; nullptr if pool is exhausted
+	    template <typename... Args>
+	    T* make(Args&&... args) { return pool_resource::make<T>(std::forward<Args>(args)...); };
+
+	}; /* aso::pool::stat */
+
+    }; /* aso::pool */
+
+
+
+    ///@brief monotonic arena with the inner buffer of the Size bytes: allocation is the pointer bump,
+    /// all the memory is released in bulk at the destroy (or release()); the upstream is used if the buffer is exhausted
+    template <size_t Size>
+    class arena: public std::pmr::monotonic_buffer_resource
+    {
+    public:
+	explicit arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()):
+	    std::pmr::monotonic_buffer_resource(body, Size, upstream) {};
+
+    protected:
+	alignas(std::max_align_t) std::byte body[Size];	///< inner buffer
+
+    }; /* aso::arena */
+
+}; /* namespace aso */
+
+
+#endif /* __POOL_HPP__ */
@@ -0,0 +1,150 @@
+/*!@file semstat.cpp
+ *
+ * @brief Opt-in per-semaphore statistics: global registry, table dump & binary snapshot
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <freertos/FreeRTOS.h>
+#include <esp_log.h>
+
+#include "semstat.hpp"
+
+
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+
+namespace aso
+{
+    namespace semstat
+    {
+	namespace
+	{
+	    const char* TAG = "aso::semstat";
+
+	    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;	///< lock of the registry & the contended counters
+	    counters* head = nullptr;				///< first node of the registry
+
+	}; /* namespace */
+
+
+	//--[ class counters ]-----------------------------------------------------------------------------------------
+
+	///@brief register the counters in the global registry
+	counters::counters(const void* owner): owner(owner)
+	{
+	    portENTER_CRITICAL_SAFE(&lock);
+	    next = head;
+	    head = this;
+	    portEXIT_CRITICAL_SAFE(&lock);
+	}; /* counters::counters() */
+
+	///@brief unregister the counters from the global registry
+	counters::~counters()
+	{
+	    portENTER_CRITICAL_SAFE(&lock);
+	    for (counters** node = &head; *node; node = &(*node)->next)
+		if (*node == this)
+		{
+		    *node = next;
+		    break;
+		}; /* if *node == this */
+	    portEXIT_CRITICAL_SAFE(&lock);
+	}; /* counters::~counters() */
+
+
+	///@brief the blocked take
+	void counters::contended_taken(bool ok, uint32_t waited, uint32_t n)
+	{
+	    taken(ok, n);
+	    portENTER_CRITICAL_SAFE(&lock);
+	    contended++;
+	    wait_total += waited;
+	    if (waited > wait_max)
+		wait_max = waited;
+	    portEXIT_CRITICAL_SAFE(&lock);
+	}; /* counters::contended_taken() */
+
+
+	///@brief current values of the counters
+	record counters::snapshot() const
+	{
+		record rec;
+
+	    portENTER_CRITICAL_SAFE(&lock);
+	    rec = {owner, takes.load(std::memory_order_relaxed), contended, timeouts.load(std::memory_order_relaxed),
+		   gives.load(std::memory_order_relaxed), wait_max, wait_total};
+	    portEXIT_CRITICAL_SAFE(&lock);
+	    return rec;
+	}; /* counters::snapshot() */
+
+	///@brief clear the counters
+	void counters::reset()
+	{
+	    portENTER_CRITICAL_SAFE(&lock);
+	    takes.store(0, std::memory_order_relaxed);
+	    timeouts.store(0, std::memory_order_relaxed);
+	    gives.store(0, std::memory_order_relaxed);
+	    contended = wait_max = 0;
+	    wait_total = 0;
+	    portEXIT_CRITICAL_SAFE(&lock);
+	}; /* counters::reset() */
+
+
+
+	//--[ registry ]-----------------------------------------------------------------------------------------------
+
+	///@brief snapshot of all registered semaphores
+	size_t snapshot(record out[], size_t n, size_t from)
+	{
+		size_t cnt = 0;
+
+	    portENTER_CRITICAL_SAFE(&lock);
+	    for (counters* node = head; node; node = node->next, cnt++)
+		if (cnt >= from && cnt - from < n)
+		    out[cnt - from] = {node->owner, node->takes.load(std::memory_order_relaxed), node->contended,
+				node->timeouts.load(std::memory_order_relaxed), node->gives.load(std::memory_order_relaxed),
+				node->wait_max, node->wait_total};
+	    portEXIT_CRITICAL_SAFE(&lock);
+	    return cnt;
+	}; /* aso::semstat::snapshot() */
+
+	///@brief clear counters of the all registered semaphores
+	void reset()
+	{
+	    portENTER_CRITICAL_SAFE(&lock);
+	    for (counters* node = head; node; node = node->next)
+	    {
+		node->takes.store(0, std::memory_order_relaxed);
+		node->timeouts.store(0, std::memory_order_relaxed);
+		node->gives.store(0, std::memory_order_relaxed);
+		node->contended = node->wait_max = 0;
+		node->wait_total = 0;
+	    }; /* for node = head; node; node = node->next */
+	    portEXIT_CRITICAL_SAFE(&lock);
+	}; /* aso::semstat::reset() */
+
+	///@brief print the table of the all registered semaphores to the log
+	void dump()
+	{
+	    // no logging in the critical section: copy the records by the fixed portions
+	    constexpr size_t portion = 8;
+		record recs[portion];
+		size_t total;
+
+	    ESP_LOGI(TAG, "%-10s %10s %10s %10s %10s %10s %12s", "semaphore", "takes", "contended", "timeouts", "gives", "wait max", "wait total");
+	    for (size_t from = 0; from < (total = snapshot(recs, portion, from)); from += portion)
+		for (size_t i = 0; i < portion && from + i < total; i++)
+		    ESP_LOGI(TAG, "%10p %10lu %10lu %10lu %10lu %10lu %12llu", recs[i].owner,
+			    (unsigned long)recs[i].takes, (unsigned long)recs[i].contended, (unsigned long)recs[i].timeouts,
+			    (unsigned long)recs[i].gives, (unsigned long)recs[i].wait_max, (unsigned long long)recs[i].wait_total);
+	}; /* aso::semstat::dump() */
+
+    }; /* namespace semstat */
+
+}; /* namespace aso */
+
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+
+
+//--[ semstat.cpp ]----------------------------------------------------------------------------------------------------
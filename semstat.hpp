@@ -0,0 +1,116 @@
+/*!@file semstat.hpp
+ *
+ * @brief Opt-in per-semaphore statistics: takes, contended takes, wait times & gives;
+ *	  global registry with the table dump & the binary snapshot; enabled by the Kconfig option ASO_UTILS_SEMAPHORE_STATS
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __SEMSTAT_HPP__
+#define __SEMSTAT_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <sdkconfig.h>
+
+
+namespace aso
+{
+    namespace semstat
+    {
+
+	///@brief binary snapshot record of the semaphore statistics
+	struct record
+	{
+	    const void* owner;		///< the semaphore object
+	    uint32_t takes;		///< count of the successful takes
+	    uint32_t contended;		///< count of the takes, that was blocked
+	    uint32_t timeouts;		///< count of the failed takes
+	    uint32_t gives;		///< count of the gives
+	    uint32_t wait_max;		///< max wait time of the contended take, us
+	    uint64_t wait_total;	///< cumulative wait time of the contended takes, us
+	}; /* record */
+
+
+#if CONFIG_ASO_UTILS_SEMAPHORE_STATS
+
+	///@brief statistics counters of the one semaphore, node of the global registry
+	class counters
+	{
+	public:
+
+	    ///@parameter [in] owner - the semaphore object, owning this counters
+	    explicit counters(const void* owner);
+	    ~counters();
+
+	    counters(const counters&) = delete;
+	    counters& operator=(const counters&) = delete;
+
+	    ///@brief the take w/o blocking
+	    ///@parameter [in] n - count of the taken units of the counting semaphore; the failed take is one timeout
+	    void taken(bool ok, uint32_t n = 1) {
+		if (ok)
+		    takes.fetch_add(n, std::memory_order_relaxed);
+		else
+		    timeouts.fetch_add(1, std::memory_order_relaxed); };
+
+	    ///@brief the blocked take
+	    ///@parameter [in] waited - wait time, us
+	    ///@parameter [in] n      - count of the taken units of the counting semaphore
+	    void contended_taken(bool ok, uint32_t waited, uint32_t n = 1);
+
+	    ///@brief the give
+	    void given(uint32_t n = 1) {
+		gives.fetch_add(n, std::memory_order_relaxed); };
+
+	    ///@brief current values of the counters
+	    record snapshot() const;
+
+	    ///@brief clear the counters
+	    void reset();
+
+	protected:
+
+	    friend size_t snapshot(record out[], size_t n, size_t from);
+	    friend void reset();
+
+	    const void* const owner;			///< the semaphore object
+	    std::atomic<uint32_t> takes {0};		///< count of the successful takes
+	    std::atomic<uint32_t> timeouts {0};		///< count of the failed takes
+	    std::atomic<uint32_t> gives {0};		///< count of the gives
+	    uint32_t contended = 0;			///< count of the takes, that was blocked; under the registry lock
+	    uint32_t wait_max = 0;			///< max wait time of the contended take, us; under the registry lock
+	    uint64_t wait_total = 0;			///< cumulative wait time of the contended takes, us; under the registry lock
+	    counters* next = nullptr;			///< next node of the registry
+
+	}; /* class counters */
+
+
+	///@brief snapshot of all registered semaphores
+	///@parameter [out] out - array for the records
+	///@parameter [in]  n    - capacity of the out array
+	///@parameter [in]  from - count of the registered semaphores to skip
+	///@return count of the registered semaphores; may be greater than from + n
+	size_t snapshot(record out[], size_t n, size_t from = 0);
+
+	///@brief clear counters of the all registered semaphores
+	void reset();
+
+	///@brief print the table of the all registered semaphores to the log
+	void dump();
+
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STATS
+
+    }; /* namespace semstat */
+
+}; /* namespace aso */
+
+
+#endif /* __SEMSTAT_HPP__ */
@@ -0,0 +1,127 @@
+/*!@file spsc_ring.hpp
+ *
+ * @brief Lock-free single-producer/single-consumer ring buffer, header template file
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __SPSC_RING_HPP__
+#define __SPSC_RING_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "hwutil.hpp"
+
+
+namespace aso
+{
+
+    ///@brief Base of the lock-free single-producer/single-consumer ring buffer;
+    /// push() must be called from the one producer task only, pop() - from the one consumer task only
+    ///@tparam T - type of the items, must be default constructible & move assignable
+    ///@tparam N - capacity of the ring, power of 2
+    template <typename T, size_t N>
+    class spsc_ring_base
+    {
+	static_assert(N > 0 && (N & (N - 1)) == 0, "capacity of the spsc_ring must be a power of 2");
+
+    public:
+
+	spsc_ring_base(const spsc_ring_base&) = delete;
+	spsc_ring_base& operator=(const spsc_ring_base&) = delete;
+
+	///@brief push the copy of the item to the ring, producer only
+	///@return false if the ring is full
+	bool push(const T& item) { return put([&](T& slot) { slot = item; }); };
+
+	///@brief move the item to the ring, producer only; item is not touched if the ring is full
+	///@return false if the ring is full
+	bool push(T&& item) { return put([&](T& slot) { slot = std::move(item); }); };
+
+	///@brief pop the item from the ring, consumer only
+	///@return false if the ring is empty
+	bool pop(T& item)
+	{
+		size_t pos = head.load(std::memory_order_relaxed);
+
+	    if (pos == tail_cache && pos == (tail_cache = tail.load(std::memory_order_acquire)))
+		return false;
+
+	    item = std::move(slots[pos & (N - 1)]);
+	    head.store(pos + 1, std::memory_order_release);
+	    return true;
+	}; /* pop() */
+
+	///@brief count of the items in the ring; exact in the producer or consumer only
+	size_t size() const { return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire); };
+
+	///@brief is the ring empty?
+	bool empty() const { return size() == 0; };
+
+	///@brief is the ring full?
+	bool full() const { return size() == N; };
+
+	///@brief capacity of the ring
+	static constexpr size_t capacity() { return N; };
+
+    protected:
+
+	explicit spsc_ring_base(T* storage): slots(storage) {};
+
+	///@brief put the item to the tail slot by the writer procedure
+	template <typename Writer>
+	bool put(Writer&& write)
+	{
+		size_t pos = tail.load(std::memory_order_relaxed);
+
+	    if (pos - head_cache == N && pos - (head_cache = head.load(std::memory_order_acquire)) == N)
+		return false;
+
+	    write(slots[pos & (N - 1)]);
+	    tail.store(pos + 1, std::memory_order_release);
+	    return true;
+	}; /* put() */
+
+	T* const slots;		///< storage of the items
+
+	alignas(hw::cache_line) std::atomic<size_t> tail {0};	///< write position, owned by the producer
+	size_t head_cache = 0;					///< producer's copy of the read position
+	alignas(hw::cache_line) std::atomic<size_t> head {0};	///< read position, owned by the consumer
+	size_t tail_cache = 0;					///< consumer's copy of the write position
+
+    }; /* aso::spsc_ring_base */
+
+
+
+    ///@brief lock-free single-producer/single-consumer ring buffer with the storage in the heap
+    template <typename T, size_t N>
+    class spsc_ring: public spsc_ring_base<T, N>
+    {
+    public:
+	spsc_ring(): spsc_ring_base<T, N>(new T[N]) {};
+	~spsc_ring() { delete[] this->slots; };
+
+	///@brief lock-free single-producer/single-consumer ring buffer with the static storage
+	class stat: public spsc_ring_base<T, N>
+	{
+	public:
+	    stat(): spsc_ring_base<T, N>(body) {};
+
+	protected:
+	    T body[N];		///< storage of the items
+
+	}; /* aso::spsc_ring::stat */
+
+    }; /* aso::spsc_ring */
+
+}; /* namespace aso */
+
+
+#endif /* __SPSC_RING_HPP__ */
@@ -7,6 +7,8 @@
  * @author: aso
  */
 
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
 #include <esp_event.h>
 #include <esp_log.h>
 
@@ -15,6 +17,79 @@
 #include "sync.hpp"
 
 
+namespace event
+{
+
+    //--[ class sync_group_base ]--------------------------------------------------------------------------------------
+
+    ///@brief set the member bit in the event group
+    void sync_group_base::member::instance_handler(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data)
+    {
+	ASO_TRACE(event, this, h_event);
+	group.set(bits);
+    }; /* sync_group_base::member::instance_handler() */
+
+
+    ///@brief common trampoline for all members: registration argument is the member itself
+    void sync_group_base::member_handler(void *arg, esp_event_base_t base, int32_t h_event, void *data)
+    {
+	member* m = static_cast<member*>(arg);
+	m->instance_handler(m->arg, base, h_event, data);
+    }; /* sync_group_base::member_handler() */
+
+
+    ///@brief Register member handler for default system loop
+    esp_err_t sync_group_base::enroll(member& m)
+    {
+	return esp_event_handler_instance_register(m.ev_base, m.event, member_handler, &m, &m.instance);
+    }; /* sync_group_base::enroll() */
+
+    ///@brief Register member handler for specified loop
+    esp_err_t sync_group_base::enroll_to(esp_event_loop_handle_t loop, member& m)
+    {
+	return esp_event_handler_instance_register_with(loop, m.ev_base, m.event, member_handler, &m, &m.instance);
+    }; /* sync_group_base::enroll_to() */
+
+    ///@brief Unregister member handler for default system loop
+    esp_err_t sync_group_base::unreg(member& m)
+    {
+	esp_err_t err = esp_event_handler_instance_unregister(m.ev_base, m.event, m.instance);
+	m.instance = nullptr;
+	return err;
+    }; /* sync_group_base::unreg() */
+
+    ///@brief Unregister member handler for specified loop
+    esp_err_t sync_group_base::unreg_from(esp_event_loop_handle_t loop, member& m)
+    {
+	esp_err_t err = esp_event_handler_instance_unregister_with(loop, m.ev_base, m.event, m.instance);
+	m.instance = nullptr;
+	return err;
+    }; /* sync_group_base::unreg_from() */
+
+
+    ///@brief wait for all of the bits are set
+    bool sync_group_base::wait_all(EventBits_t bits, TickType_t ticks, bool clear)
+    {
+	return (xEventGroupWaitBits(group, bits, clear? pdTRUE: pdFALSE, pdTRUE, ticks) & bits) == bits;
+    }; /* sync_group_base::wait_all() */
+
+    ///@brief wait for any of the bits is set
+    EventBits_t sync_group_base::wait_any(EventBits_t bits, TickType_t ticks, bool clear)
+    {
+	return xEventGroupWaitBits(group, bits, clear? pdTRUE: pdFALSE, pdFALSE, ticks) & bits;
+    }; /* sync_group_base::wait_any() */
+
+
+    ///@brief delete the event group
+    sync_group_base::~sync_group_base()
+    {
+	if (created())
+	    vEventGroupDelete(group);
+	group = nullptr;
+    }; /* sync_group_base::~sync_group_base() */
+
+}; /* namespace event */
+
 
 
 //--[ sync.cpp ]-------------------------------------------------------------------------------------------------------
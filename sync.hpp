@@ -2,6 +2,8 @@
  *
  * @brief Syncronization utilily: combined the semaphore cless asemaphore, handler procedure for give the semaphore and event registration for this, header template file
  *
+ * @note  Need pre-included including files asemaphore & event_ctrl.hpp
+ *
  * @date Created on: 22 февр. 2024 г.
  * @author: aso
  */
@@ -13,49 +15,176 @@
 #error File __FILE__ is not intended to use with a pure C
 #endif	// __cplusplus
 
+#include <type_traits>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+#include "trace.hpp"
+#include "ticks.hpp"
 
 
 ///@brief milliseconds in second
 constexpr unsigned int SEC2mSEC = 1000;
 
 
-inline TickType_t msticks(TickType_t millisec) {
-    return millisec * portTICK_PERIOD_MS; }
+///@brief milliseconds to ticks, not shorter than requested
+constexpr TickType_t msticks(TickType_t millisec) {
+    return aso::ticks::of(std::chrono::milliseconds(millisec)); }
 
 
-inline TickType_t secticks(TickType_t sec) {
-    return msticks(sec * portTICK_PERIOD_MS); }
+///@brief seconds to ticks, not shorter than requested
+constexpr TickType_t secticks(TickType_t sec) {
+    return aso::ticks::of(std::chrono::seconds(sec)); }
 
 
 namespace event
 {
 
-    struct sync: handler::base
+    ///@brief Synchronizer: give the inner semaphore when the event is handled
+    ///@tparam Semaphore - the inner semaphore type: asemaphore, asemaphore::stat or asemaphore::notify
+    template <typename Semaphore>
+    struct basic_sync: handler::base
     {
-	sync(esp_event_base_t ev_base, uint32_t ev, void *data = nullptr): handler::base(ev_base, ev, data) {};
+	basic_sync(esp_event_base_t ev_base, uint32_t ev, void *data = nullptr): handler::base(ev_base, ev, data) {};
+
+	Semaphore wait;
+
+	///@brief wait for the event
+	BaseType_t Take(TickType_t ticks = portMAX_DELAY) { return wait.Take(ticks); };
+
+	///@brief wait for the event, not shorter than timeout
+	template <class Rep, class Period>
+	BaseType_t Take(std::chrono::duration<Rep, Period> timeout) { return wait.Take(aso::ticks::of(timeout)); };
 
-	asemaphore wait;
+	///@brief wait for the event up to the deadline
+	BaseType_t Take_until(aso::ticks::deadline dl) { return wait.Take(aso::ticks::remaining(dl)); };
 
 	///@brief reset/give the inner semaphore
 	void instance_handler(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data) override {
-	    ESP_LOGI(__PRETTY_FUNCTION__, "Now We Give (Released) the Semaphore");
+	    ASO_TRACE(event, this, h_event);
 	    wait.Give();
 	}; /* instance_handler() */
 
+    }; /* event::basic_sync */
+
+
+    struct sync: basic_sync<asemaphore>
+    {
+	using basic_sync::basic_sync;
+
 	/// Statically implementation of syncronizer
-	struct stat: handler::base
+	using stat = basic_sync<asemaphore::stat>;
+
+	/// Syncronizer on the task notification: for one waiting task only, the fastest & w/o semaphore object;
+	/// the waiting task is the task, that created the synchronizer or first called wait.Take()
+	using notify = basic_sync<asemaphore::notify>;
+
+    }; /* event::sync */
+
+
+
+    ///@brief Group synchronizer: multiple events are mapped to the bits of the one FreeRTOS event group;
+    /// the task waits for all or any of them by the single blocking call
+    class sync_group_base
+    {
+    public:
+
+	///@brief max count of the bits in the event group
+	static constexpr unsigned max_bits = 24;
+
+	///@brief member of the group: set own bit(s) when the event is handled
+	struct member: handler::base
 	{
-		stat(esp_event_base_t ev_base, uint32_t ev, void *data = nullptr): handler::base(ev_base, ev, data) {};
+	    ///@parameter [in] grp - group, owning this member
+	    ///@parameter [in] bit - number of the bit in the event group, set by this member: less than max_bits
+	    member(sync_group_base& grp, unsigned bit, esp_event_base_t ev_base, uint32_t ev, void *data = nullptr):
+		handler::base(ev_base, ev, data), group(grp), bits(bit < max_bits? EventBits_t(1) << bit: 0) {
+		configASSERT(bit < max_bits && "event::sync_group_base::member: the bit must be less than max_bits (24)"); };
 
-		asemaphore::stat wait;
+	    ///@brief member with the bit number, checked at the compile time
+	    template <unsigned Bit>
+	    member(sync_group_base& grp, std::integral_constant<unsigned, Bit>, esp_event_base_t ev_base, uint32_t ev, void *data = nullptr):
+		member(grp, Bit, ev_base, ev, data) {
+		static_assert(Bit < max_bits, "event::sync_group_base::member: the bit must be less than max_bits (24), "
+			"the top bits of the event group are reserved by the FreeRTOS"); };
 
-		///@brief reset/give the inner semaphore
-		void instance_handler(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data) override {
-		    wait.Give();
-		}; /* instance_handler() */
-	}; /* event::sync::stat */
+	    ///@brief set the member bit in the event group
+	    void instance_handler(void *arg, esp_event_base_t ev_base, int32_t h_event, void *data) override;
 
-    }; /* event::sync */
+	    sync_group_base& group;	///< group, owning this member
+	    const EventBits_t bits;	///< bits of the event group, set by this member
+	}; /* member */
+
+	sync_group_base(const sync_group_base&) = delete;
+	sync_group_base& operator=(const sync_group_base&) = delete;
+
+	///@brief Register member handler for default system loop
+	static esp_err_t enroll(member& m);
+
+	///@brief Register member handler for specified loop
+	static esp_err_t enroll_to(esp_event_loop_handle_t loop, member& m);
+
+	///@brief Unregister member handler for default system loop
+	static esp_err_t unreg(member& m);
+
+	///@brief Unregister member handler for specified loop
+	static esp_err_t unreg_from(esp_event_loop_handle_t loop, member& m);
+
+	///@brief wait for all of the bits are set
+	///@return true if all bits are set before timeout
+	bool wait_all(EventBits_t bits, TickType_t ticks = portMAX_DELAY, bool clear = true);
+
+	///@brief wait for any of the bits is set
+	///@return set bits from the waited bits; 0 on timeout
+	EventBits_t wait_any(EventBits_t bits, TickType_t ticks = portMAX_DELAY, bool clear = true);
+
+	///@brief set bits manually
+	EventBits_t set(EventBits_t bits) { return xEventGroupSetBits(group, bits); };
+
+	///@brief clear bits manually
+	EventBits_t clear(EventBits_t bits) { return xEventGroupClearBits(group, bits); };
+
+	///@brief current state of the bits
+	EventBits_t bits() { return xEventGroupGetBits(group); };
+
+	///@brief get the event group handle
+	EventGroupHandle_t handle() { return group; };
+
+	///@brief is event group was created?
+	bool created() { return group != nullptr; };
+
+    protected:
+
+	sync_group_base() {};
+	~sync_group_base();
+
+	///@brief common trampoline for all members: registration argument is the member itself
+	static void member_handler(void *arg, esp_event_base_t base, int32_t h_event, void *data);
+
+	EventGroupHandle_t group = nullptr;	///< event group handle
+
+    }; /* event::sync_group_base */
+
+
+    ///@brief Group synchronizer with the dynamically allocated event group
+    class sync_group: public sync_group_base
+    {
+    public:
+
+	sync_group() { group = xEventGroupCreate(); };
+
+	///@brief Group synchronizer with the static storage of the event group
+	class stat: public sync_group_base
+	{
+	public:
+	    stat() { group = xEventGroupCreateStatic(&body); };
+
+	protected:
+	    StaticEventGroup_t body;	///< Body of the event group buffer
+	}; /* stat */
+
+    }; /* event::sync_group */
 
 }; /* namespace event */
 
@@ -0,0 +1,175 @@
+/*!@file task_pool.cpp
+ *
+ * @brief Work-stealing task pool, implementation C++ body file
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#include "asemaphore"
+#include "task_pool.hpp"
+
+
+
+namespace aso
+{
+
+    //--[ class task_pool ]--------------------------------------------------------------------------------------------
+
+    thread_local task_pool::worker* task_pool::running = nullptr;
+
+
+    task_pool::task_pool(unsigned workers, UBaseType_t prio, uint32_t stack, size_t jobs):
+	count(workers? workers: 1), workers(new worker[count]), jobs(sizeof(job), jobs, alignof(job)),
+	wakeup(count, 0), exited(count, 0)
+    {
+	for (unsigned i = 0; i < count; i++)
+	{
+	    this->workers[i].owner = this;
+	    if (xTaskCreatePinnedToCore(worker_proc, "task_pool", stack, &this->workers[i], prio,
+		    &this->workers[i].task, i % portNUM_PROCESSORS) != pdPASS)
+		this->workers[i].task = nullptr;
+	}; /* for i < count */
+    }; /* task_pool::task_pool() */
+
+    ///@brief stop the workers: the submitted jobs are finished before
+    task_pool::~task_pool()
+    {
+	stopping.store(true, std::memory_order_seq_cst);
+	for (unsigned i = 0; i < count; i++)
+	    if (workers[i].task)
+	    {
+		wakeup.Give();
+		exited.Take();
+	    }; /* if workers[i].task */
+	delete[] workers;
+    }; /* task_pool::~task_pool() */
+
+
+    ///@brief wait for the all jobs of the wait group are finished, helping to run the jobs
+    bool task_pool::wait(wait_group& wg, TickType_t ticks)
+    {
+	TimeOut_t timeout;
+
+	vTaskSetTimeOutState(&timeout);
+	while (!wg.finished())
+	{
+	    if (xTaskCheckForTimeOut(&timeout, &ticks) != pdFALSE)
+		return wg.finished();
+	    if (!run_one(current()))
+		// nothing to help: the rest jobs are running by the others
+		return wg.wait(ticks);
+	}; /* while !wg.finished() */
+	return true;
+    }; /* task_pool::wait() */
+
+
+    ///@brief put the job to the deque of the current worker or to the injection queue
+    bool task_pool::enqueue(job* j)
+    {
+	worker* self = current();
+
+	if (!(self && self->deque.push(j)) && !injection.push(j))
+	    return false;
+	wake();
+	return true;
+    }; /* task_pool::enqueue() */
+
+
+    ///@brief run the job & free it
+    void task_pool::execute(job* j)
+    {
+	wait_group* wg = j->group;
+
+	j->call(j);
+	jobs.free_block(j);
+	if (wg)
+	    wg->done();
+    }; /* task_pool::execute() */
+
+
+    ///@brief find & run the one job
+    bool task_pool::run_one(worker* self)
+    {
+	job* j;
+
+	if ((self && self->deque.pop(j)) || injection.pop(j))
+	{
+	    execute(j);
+	    return true;
+	}; /* if own or injected job */
+
+	// steal, starting from the next worker: spread the thieves
+	unsigned start = self? static_cast<unsigned>(self - workers) + 1: 0;
+	for (unsigned i = 0; i < count; i++)
+	{
+	    worker& victim = workers[(start + i) % count];
+	    if (&victim != self && victim.deque.steal(j))
+	    {
+		execute(j);
+		return true;
+	    }; /* if steal() */
+	}; /* for i < count */
+	return false;
+    }; /* task_pool::run_one() */
+
+
+    ///@brief is the any job available?
+    bool task_pool::has_work() const
+    {
+	if (!injection.empty())
+	    return true;
+	for (unsigned i = 0; i < count; i++)
+	    if (!workers[i].deque.empty())
+		return true;
+	return false;
+    }; /* task_pool::has_work() */
+
+
+    ///@brief wake up the one parked worker, if present
+    void task_pool::wake()
+    {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (sleepers.load(std::memory_order_relaxed) > 0)
+	    wakeup.Give();
+    }; /* task_pool::wake() */
+
+
+    ///@brief the worker task loop
+    void task_pool::work(worker* self)
+    {
+	running = self;
+	for (;;)
+	{
+	    if (run_one(self))
+		continue;
+	    if (stopping.load(std::memory_order_acquire))
+		break;
+
+	    sleepers.fetch_add(1, std::memory_order_seq_cst);
+	    std::atomic_thread_fence(std::memory_order_seq_cst);
+	    // re-check after registering as sleeper: the job may be enqueued before
+	    if (!has_work() && !stopping.load(std::memory_order_seq_cst))
+		wakeup.Take();
+	    sleepers.fetch_sub(1, std::memory_order_relaxed);
+	}; /* for (;;) */
+	running = nullptr;
+	exited.Give();
+    }; /* task_pool::work() */
+
+
+    void task_pool::worker_proc(void* arg)
+    {
+	worker* self = static_cast<worker*>(arg);
+	self->owner->work(self);
+	vTaskDelete(nullptr);
+    }; /* task_pool::worker_proc() */
+
+}; /* namespace aso */
+
+
+//--[ task_pool.cpp ]--------------------------------------------------------------------------------------------------
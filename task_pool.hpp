@@ -0,0 +1,333 @@
+/*!@file task_pool.hpp
+ *
+ * @brief Work-stealing task pool: the worker per core with the Chase-Lev deque, the injection queue for the external
+ *	  submits, parking of the idle workers on the counting semaphore; submit, parallel_for & fork/join wait_group
+ *
+ * @note  Need pre-included including files freertos/task.h, semphr.h & asemaphore
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __TASK_POOL_HPP__
+#define __TASK_POOL_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "hwutil.hpp"
+#include "pool.hpp"
+#include "mpmc_queue.hpp"
+
+
+namespace aso
+{
+
+    ///@brief Chase-Lev work-stealing deque of the fixed capacity (Le, Pop, Cohen, Nardelli memory model variant):
+    /// the owner pushes & pops at the bottom, the thieves steal from the top
+    ///@tparam T - type of the items: pointers or the other trivially copyable types
+    ///@tparam N - capacity of the deque, power of 2
+    template <typename T, size_t N>
+    class ws_deque
+    {
+	static_assert(N > 1 && (N & (N - 1)) == 0, "capacity of the ws_deque must be a power of 2");
+	static_assert(std::is_trivially_copyable_v<T>, "items of the ws_deque must be trivially copyable");
+
+    public:
+
+	///@brief push the item to the bottom, owner only
+	///@return false if the deque is full
+	bool push(T item)
+	{
+	    intptr_t b = bottom.load(std::memory_order_relaxed);
+	    intptr_t t = top.load(std::memory_order_acquire);
+
+	    if (b - t >= static_cast<intptr_t>(N))
+		return false;
+	    slots[b & (N - 1)].store(item, std::memory_order_relaxed);
+	    std::atomic_thread_fence(std::memory_order_release);
+	    bottom.store(b + 1, std::memory_order_relaxed);
+	    return true;
+	}; /* push() */
+
+	///@brief pop the item from the bottom, owner only
+	///@return false if the deque is empty or the last item was stolen
+	bool pop(T& item)
+	{
+	    intptr_t b = bottom.load(std::memory_order_relaxed) - 1;
+	    bottom.store(b, std::memory_order_relaxed);
+	    std::atomic_thread_fence(std::memory_order_seq_cst);
+	    intptr_t t = top.load(std::memory_order_relaxed);
+
+	    if (t > b)
+	    {
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return false;
+	    }; /* if t > b */
+
+	    item = slots[b & (N - 1)].load(std::memory_order_relaxed);
+	    if (t < b)
+		return true;
+
+	    // the last item: race with the thieves
+	    bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+	    bottom.store(b + 1, std::memory_order_relaxed);
+	    return won;
+	}; /* pop() */
+
+	///@brief steal the item from the top, any task
+	///@return false if the deque is empty or the race with the other thief or the owner was lost
+	bool steal(T& item)
+	{
+	    intptr_t t = top.load(std::memory_order_acquire);
+	    std::atomic_thread_fence(std::memory_order_seq_cst);
+	    intptr_t b = bottom.load(std::memory_order_acquire);
+
+	    if (t >= b)
+		return false;
+	    item = slots[t & (N - 1)].load(std::memory_order_relaxed);
+	    return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+	}; /* steal() */
+
+	///@brief is the deque empty? approximate
+	bool empty() const {
+	    return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed); };
+
+	///@brief capacity of the deque
+	static constexpr size_t capacity() { return N; };
+
+    protected:
+	alignas(hw::cache_line) std::atomic<intptr_t> top {0};		///< steal position, shared by the thieves
+	alignas(hw::cache_line) std::atomic<intptr_t> bottom {0};	///< push & pop position of the owner
+	std::atomic<T> slots[N] {};					///< items
+
+    }; /* aso::ws_deque */
+
+
+
+    ///@brief fork/join counter of the jobs: the jobs are counted by the submit, uncounted at the end of the job;
+    /// the one task at a time may wait for the group
+    class wait_group
+    {
+    public:
+
+	wait_group() {};
+	wait_group(const wait_group&) = delete;
+	wait_group& operator=(const wait_group&) = delete;
+
+	///@brief count the jobs
+	void add(int n = 1) { state.fetch_add(n * job, std::memory_order_relaxed); };
+
+	///@brief uncount the finished job; the last one wakes up the waiting task exactly once
+	void done()
+	{
+		int s = state.load(std::memory_order_relaxed);
+
+	    // the last job clears the waiting flag by the same exchange: the group is not touched after the give
+	    while (!state.compare_exchange_weak(s, s == job + waiting? 0: s - job, std::memory_order_acq_rel, std::memory_order_relaxed));
+	    if (s == job + waiting)
+		// the raw give: the waiter may destroy the group as soon as it wakes up,
+		// the semaphore object is not touched by the FreeRTOS after the waiter is unblocked
+		xSemaphoreGive(ready.handle());
+	}; /* done() */
+
+	///@brief are all the jobs finished?
+	bool finished() const { return state.load(std::memory_order_acquire) < job; };
+
+	///@brief wait for the all jobs are finished, w/o helping: not for the worker tasks, use the task_pool::wait()
+	///@parameter [in] ticks - timeout of the waiting
+	///@return false if the timeout was expired
+	bool wait(TickType_t ticks = portMAX_DELAY)
+	{
+		int s = state.load(std::memory_order_acquire);
+
+	    do
+	    {
+		if (s < job)
+		    return true;
+		configASSERT(!(s & waiting) && "the one task at a time may wait for the wait_group");
+	    } while (!state.compare_exchange_weak(s, s | waiting, std::memory_order_acq_rel, std::memory_order_acquire));
+
+	    if (ready.Take(ticks) == pdTRUE)
+		return true;
+
+	    // timeout: withdraw the waiting flag, unless the last done() has cleared it already & it's give is coming
+	    s = state.load(std::memory_order_relaxed);
+	    while (s & waiting)
+		if (state.compare_exchange_weak(s, s & ~waiting, std::memory_order_acq_rel, std::memory_order_relaxed))
+		    return false;
+	    ready.Take();
+	    return true;
+	}; /* wait() */
+
+    protected:
+
+	static constexpr int waiting = 1;	///< the flag of the waiting task in the state
+	static constexpr int job = 2;		///< the one job in the state
+
+	std::atomic<int> state {0};	///< count of the not finished jobs * job | waiting
+	asemaphore::stat ready;		///< signal "all jobs are finished" to the waiting task
+
+    }; /* aso::wait_group */
+
+
+
+    ///@brief Work-stealing task pool: the worker task per core;
+    /// the small callables are placed to the jobs from the fixed pool, the job is run inline if no room for it
+    class task_pool
+    {
+    public:
+
+	///@brief max size of the callable, placed to the job
+	static constexpr size_t job_capacity = 48;
+
+	///@brief capacity of the worker deque
+	static constexpr size_t deque_capacity = 128;
+
+	///@brief capacity of the injection queue for the submits from the non-worker tasks
+	static constexpr size_t inject_capacity = 64;
+
+	///@parameter [in] workers - count of the workers, pinned to the cores by the round-robin
+	///@parameter [in] prio    - priority of the worker tasks
+	///@parameter [in] stack   - stack size of the worker tasks
+	///@parameter [in] jobs    - count of the jobs in the job pool
+	explicit task_pool(unsigned workers = portNUM_PROCESSORS, UBaseType_t prio = 5, uint32_t stack = 4096, size_t jobs = 256);
+
+	///@brief stop the workers: the submitted jobs are finished before
+	~task_pool();
+
+	task_pool(const task_pool&) = delete;
+	task_pool& operator=(const task_pool&) = delete;
+
+	///@brief submit the callable f() to the pool
+	///@parameter [in] wg - the wait group, counting the job; may be nullptr
+	///@return false if the job was run inline: no free job or no room in the queues
+	template <typename F>
+	bool submit(F&& f, wait_group* wg = nullptr)
+	{
+	    using Fn = std::decay_t<F>;
+	    static_assert(sizeof(Fn) <= job_capacity && alignof(Fn) <= alignof(std::max_align_t), "callable is too big for the task_pool job");
+
+	    if (wg)
+		wg->add();
+
+	    job* j = static_cast<job*>(jobs.allocate_block());
+	    if (j)
+	    {
+		new (j->body) Fn(std::forward<F>(f));
+		j->call = invoke<Fn>;
+		j->group = wg;
+		if (enqueue(j))
+		    return true;
+		execute(j);
+		return false;
+	    }; /* if j */
+
+	    f();
+	    if (wg)
+		wg->done();
+	    return false;
+	}; /* submit() */
+
+	///@brief run f(begin, end) for the chunks of the range [begin, end) in parallel & wait for all of them
+	///@parameter [in] grain - size of the chunk; 0 - split to 4 chunks per worker
+	template <typename F>
+	void parallel_for(size_t begin, size_t end, size_t grain, F&& f)
+	{
+		wait_group wg;
+
+	    if (end <= begin)
+		return;
+	    if (grain == 0)
+		grain = (end - begin + 4 * count - 1) / (4 * count);
+	    for (size_t b = begin; b < end; b += grain)
+	    {
+		size_t e = end - b > grain? b + grain: end;
+		submit([&f, b, e] { f(b, e); }, &wg);
+	    }; /* for b < end */
+	    wait(wg);
+	}; /* parallel_for() */
+
+	///@brief wait for the all jobs of the wait group are finished, helping to run the jobs;
+	/// blocks on the wait group when there is no job to help
+	///@parameter [in] ticks - timeout of the waiting
+	///@return false if the timeout was expired
+	bool wait(wait_group& wg, TickType_t ticks = portMAX_DELAY);
+
+	///@brief count of the workers
+	unsigned size() const { return count; };
+
+    protected:
+
+	///@brief the job: the callable in the inline storage
+	struct job
+	{
+	    alignas(std::max_align_t) std::byte body[job_capacity];	///< the callable
+	    void (*call)(job*);						///< run & destroy the callable
+	    wait_group* group;						///< wait group of the job
+	}; /* job */
+
+	///@brief the worker: the task with the deque
+	struct alignas(hw::cache_line) worker
+	{
+	    ws_deque<job*, deque_capacity> deque;	///< jobs of the worker
+	    task_pool* owner = nullptr;			///< pool of the worker
+	    TaskHandle_t task = nullptr;		///< worker task
+	}; /* worker */
+
+	template <typename Fn>
+	static void invoke(job* j) {
+	    Fn* fn = std::launder(reinterpret_cast<Fn*>(j->body));
+	    (*fn)();
+	    fn->~Fn(); };
+
+	///@brief put the job to the deque of the current worker or to the injection queue & wake up the parked worker
+	bool enqueue(job* j);
+
+	///@brief run the job & free it
+	void execute(job* j);
+
+	///@brief find & run the one job: from own deque, from the injection queue, stolen from the other workers
+	///@parameter [in] self - the current worker or nullptr for the non-worker task
+	bool run_one(worker* self);
+
+	///@brief is the any job available?
+	bool has_work() const;
+
+	///@brief wake up the one parked worker, if present
+	void wake();
+
+	///@brief the worker task loop
+	void work(worker* self);
+
+	static void worker_proc(void* arg);
+
+	///@brief the current worker of this pool or nullptr
+	worker* current() const {
+	    return (running && running->owner == this)? running: nullptr; };
+
+	const unsigned count;				///< count of the workers
+	worker* const workers;				///< the workers
+	pool_resource jobs;				///< pool of the jobs
+	mpmc_queue<job*, inject_capacity> injection;	///< jobs, submitted by the non-worker tasks
+	std::atomic<int> sleepers {0};			///< count of the parked workers
+	std::atomic<bool> stopping {false};		///< the pool is destroyed
+	asemaphore::stat wakeup;			///< the parked workers wait on it
+	asemaphore::stat exited;			///< the workers signal the exit
+
+	static thread_local worker* running;		///< the worker of the current task
+
+    }; /* aso::task_pool */
+
+}; /* namespace aso */
+
+
+#endif /* __TASK_POOL_HPP__ */
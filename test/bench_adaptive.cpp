@@ -0,0 +1,113 @@
+/*!@file bench_adaptive.cpp
+ *
+ * @brief The adaptive spin-then-block lock against the pure blocking locks (the amutex & the binary semaphore)
+ *	  at the several lengths of the critical section, by the 2 contending tasks
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "asemaphore"
+#include "amutex"
+
+
+namespace
+{
+
+///@brief the binary semaphore as the lock, the former practice
+struct semaphore_lock
+{
+    void lock() { sem.Take(); };
+    void unlock() { sem.Give(); };
+
+    asemaphore sem {true};
+}; /* struct semaphore_lock */
+
+///@brief the critical section of the given count of the dependent operations
+void section(int64_t length)
+{
+	uint32_t x = 1;
+
+    for (int64_t i = 0; i < length; i++)
+	x = x * 1664525 + 1013904223;
+    benchmark::DoNotOptimize(x);
+}; /* section() */
+
+template <typename Lock>
+void report(benchmark::State&, Lock&) {};
+
+void report(benchmark::State& state, amutex::adaptive& lock)
+{
+    state.counters["spins"] = lock.spins();
+    state.counters["parks"] = lock.parks();
+}; /* report() */
+
+}; /* namespace */
+
+
+///@brief the benchmark task & the partner task take the lock in turn; arg: the length of the critical section
+template <typename Lock>
+static void BM_lock(benchmark::State& state)
+{
+	Lock lock;
+	std::atomic<bool> stop {false};
+	std::thread partner([&] {
+	    while (!stop)
+	    {
+		    std::lock_guard guard(lock);
+
+		section(state.range(0));
+	    }
+	});
+
+    for (auto _: state)
+    {
+	    std::lock_guard guard(lock);
+
+	section(state.range(0));
+    }
+    stop = true;
+    partner.join();
+    report(state, lock);
+}; /* BM_lock() */
+BENCHMARK(BM_lock<amutex::adaptive>)->Name("BM_adaptive")->Arg(0)->Arg(16)->Arg(256)->UseRealTime();
+
+///@brief the adaptive lock w/o spinning: the atomic fast path & the blocking only
+struct adaptive_nospin: amutex::adaptive
+{
+    adaptive_nospin(): amutex::adaptive(0) {};
+}; /* struct adaptive_nospin */
+
+void report(benchmark::State& state, adaptive_nospin& lock) { report(state, static_cast<amutex::adaptive&>(lock)); };
+
+BENCHMARK(BM_lock<adaptive_nospin>)->Name("BM_adaptive_nospin")->Arg(0)->Arg(16)->Arg(256)->UseRealTime();
+BENCHMARK(BM_lock<amutex>)->Name("BM_amutex")->Arg(0)->Arg(16)->Arg(256)->UseRealTime();
+BENCHMARK(BM_lock<semaphore_lock>)->Name("BM_semaphore")->Arg(0)->Arg(16)->Arg(256)->UseRealTime();
+
+///@brief uncontended lock & unlock
+template <typename Lock>
+static void BM_uncontended(benchmark::State& state)
+{
+	Lock lock;
+
+    for (auto _: state)
+    {
+	lock.lock();
+	lock.unlock();
+    }
+}; /* BM_uncontended() */
+BENCHMARK(BM_uncontended<amutex::adaptive>)->Name("BM_adaptive_uncontended");
+BENCHMARK(BM_uncontended<amutex>)->Name("BM_amutex_uncontended");
+BENCHMARK(BM_uncontended<semaphore_lock>)->Name("BM_semaphore_uncontended");
+
+BENCHMARK_MAIN();
@@ -0,0 +1,162 @@
+/*!@file bench_answer.cpp
+ *
+ * @brief Benchmark of the astr::confirm()/decline() against the former allocating path
+ *	  of the tolower() copy & the is_zero()/is_digitex()/is_space() passes; counts the heap allocations
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "astring.h"
+
+
+namespace
+{
+
+std::atomic<size_t> allocations {0};
+
+}; /* namespace */
+
+// counting replacement of the global allocation functions; gcc doesn't see the operator new is replaced too
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size? size: 1))
+	return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+
+///@brief the former implementation of the answer words, for the comparison
+namespace former
+{
+
+std::string tolower(std::string str)
+{
+    for (char& c: str)
+	c = ::tolower(static_cast<unsigned char>(c));
+    return str;
+}; /* tolower() */
+
+bool is_space(const std::string& str)
+{
+	bool resf = true;
+
+    if (str == "")
+	return true;
+    for (unsigned char c: str)
+	if (!std::isspace(c))
+	    resf = false;
+    return resf;
+}; /* is_space() */
+
+bool is_digitex(const std::string& str)
+{
+	bool withdigit = false;
+	bool spdigit = true;
+
+    for (unsigned char c: str)
+    {
+	if (std::isdigit(c))
+	    withdigit = true;
+	else if (c != '_' || !std::isspace(c))
+	    spdigit = false;
+    }
+    return (withdigit && spdigit);
+}; /* is_digitex() */
+
+bool is_zero(const std::string& str)
+{
+	bool accept = false;
+	bool decline = false;
+
+    if (!is_digitex(str))
+	return false;
+    for (unsigned char c: str)
+	if (c == '0')
+	    accept = true;
+	else if (!(std::isspace(c) || c == '.' || (std::tolower(static_cast<unsigned char>(c) == 'x'))))
+	    decline = true;
+    return accept && !decline;
+}; /* is_zero() */
+
+bool confirm(const std::string& bst)
+{
+	std::string buf = tolower(bst);
+    return ((!is_zero(buf) && is_digitex(buf)) || buf == "on" || buf == "ok" || buf == "y" || buf == "yes");
+}; /* confirm() */
+
+bool decline(const std::string& bst)
+{
+	std::string buf = tolower(bst);
+    return (is_space(buf) || is_zero(buf) || buf == "n" || buf == "no" || buf == "cancel");
+}; /* decline() */
+
+}; /* namespace former */
+
+
+namespace
+{
+
+// the long words don't fit to the SSO buffer of the std::string
+const char* const words[] = {"yes", "On", "1", "nope", "Enable", "cancel", "0", "CONFIRMATION_IS_NOT_GIVEN_HERE"};
+
+template <typename Check>
+void run(benchmark::State& state, Check check)
+{
+	size_t i = 0;
+	size_t before = allocations.load();
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(check(words[i++ % std::size(words)]));
+    state.counters["allocs/call"] = benchmark::Counter(double(allocations.load() - before) / double(state.iterations()));
+}; /* run() */
+
+}; /* namespace */
+
+
+static void BM_confirm(benchmark::State& state)
+{
+    run(state, [](const char* w) { return astr::confirm(w); });
+}; /* BM_confirm() */
+BENCHMARK(BM_confirm);
+
+static void BM_confirm_former(benchmark::State& state)
+{
+    run(state, [](const char* w) { return former::confirm(w); });
+}; /* BM_confirm_former() */
+BENCHMARK(BM_confirm_former);
+
+static void BM_decline(benchmark::State& state)
+{
+    run(state, [](const char* w) { return astr::decline(w); });
+}; /* BM_decline() */
+BENCHMARK(BM_decline);
+
+static void BM_decline_former(benchmark::State& state)
+{
+    run(state, [](const char* w) { return former::decline(w); });
+}; /* BM_decline_former() */
+BENCHMARK(BM_decline_former);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,167 @@
+/*!@file bench_argview.cpp
+ *
+ * @brief Command dispatch with 1, 8 & 32 arguments: the heap std::vector<std::string> of the mk_containerholder
+ *	  against the arena-backed containers & the argview over the argv; counts the heap allocations
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "argview.hpp"
+#include "astring.h"
+#include "pool.hpp"
+
+
+namespace
+{
+
+std::atomic<size_t> allocations {0};
+
+}; /* namespace */
+
+// counting replacement of the global allocation functions; gcc doesn't see the operator new is replaced too
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void* operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size? size: 1))
+	return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+// the std::pmr::new_delete_resource allocates by the aligned form
+void* operator new(size_t size, std::align_val_t align)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::aligned_alloc(static_cast<size_t>(align), (size + static_cast<size_t>(align) - 1) & ~(static_cast<size_t>(align) - 1)))
+	return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+
+namespace
+{
+
+///@brief the command line of the argc arguments, half of them are longer than the small string buffer
+struct command
+{
+    explicit command(int argc) {
+	for (int i = 0; i < argc; i++)
+	    words.push_back(i % 2? "--option-name-longer-than-sso=" + std::to_string(i): "arg" + std::to_string(i));
+	for (std::string& w: words)
+	    argv.push_back(w.data()); };
+
+    int argc() { return argv.size(); };
+
+    std::vector<std::string> words;
+    std::vector<char*> argv;
+}; /* struct command */
+
+///@brief the command handler: looks at all the arguments
+template <typename Args>
+size_t dispatch(const Args& args)
+{
+	size_t len = 0;
+
+    for (const auto& arg: args)
+	len += arg.size();
+    return len;
+}; /* dispatch() */
+
+void report(benchmark::State& state, size_t before)
+{
+    state.counters["allocs"] = benchmark::Counter(allocations - before, benchmark::Counter::kAvgIterations);
+}; /* report() */
+
+}; /* namespace */
+
+
+static void BM_dispatch_heap(benchmark::State& state)
+{
+	command cmd(state.range(0));
+	size_t before = allocations;
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(dispatch(astr::mk_containerholder<std::vector, std::basic_string>(cmd.argc(), cmd.argv.data())));
+    report(state, before);
+}; /* BM_dispatch_heap() */
+BENCHMARK(BM_dispatch_heap)->Arg(1)->Arg(8)->Arg(32);
+
+static void BM_dispatch_arena(benchmark::State& state)
+{
+	command cmd(state.range(0));
+	size_t before = allocations;
+
+    for (auto _: state)
+    {
+	    aso::arena<4096> arena;
+
+	benchmark::DoNotOptimize(dispatch(astr::makestor<std::pmr::vector<std::pmr::string>>(cmd.argc(), cmd.argv.data(), &arena)));
+    }
+    report(state, before);
+}; /* BM_dispatch_arena() */
+BENCHMARK(BM_dispatch_arena)->Arg(1)->Arg(8)->Arg(32);
+
+static void BM_dispatch_argview_buffer(benchmark::State& state)
+{
+	command cmd(state.range(0));
+	size_t before = allocations;
+
+    for (auto _: state)
+    {
+	    std::string_view buf[32];
+
+	benchmark::DoNotOptimize(dispatch(astr::argview(cmd.argc(), cmd.argv.data(), buf)));
+    }
+    report(state, before);
+}; /* BM_dispatch_argview_buffer() */
+BENCHMARK(BM_dispatch_argview_buffer)->Arg(1)->Arg(8)->Arg(32);
+
+///@brief the only one allocation per command, from the heap upstream of the empty arena
+static void BM_dispatch_argview_arena(benchmark::State& state)
+{
+	command cmd(state.range(0));
+	size_t before = allocations;
+
+    for (auto _: state)
+    {
+	    std::pmr::monotonic_buffer_resource arena(std::pmr::new_delete_resource());
+
+	benchmark::DoNotOptimize(dispatch(astr::argview(cmd.argc(), cmd.argv.data(), &arena)));
+    }
+    report(state, before);
+}; /* BM_dispatch_argview_arena() */
+BENCHMARK(BM_dispatch_argview_arena)->Arg(1)->Arg(8)->Arg(32);
+
+BENCHMARK_MAIN();
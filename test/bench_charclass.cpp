@@ -0,0 +1,122 @@
+/*!@file bench_charclass.cpp
+ *
+ * @brief SWAR scanning of the character classes against the byte-by-byte scanning
+ *	  by the table & by the <cctype>, on the short tokens (8 B) & the long buffers (4 KB)
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cctype>
+#include <string>
+
+#include "astring.h"
+#include "charclass.hpp"
+
+
+namespace chr = astr::chr;
+
+namespace
+{
+
+///@brief the class chars of the given length & the one non-class char at the end
+std::string sample(size_t len, char fill)
+{
+	std::string s(len, fill);
+
+    s.back() = 'x';
+    return s;
+}; /* sample() */
+
+size_t scalar_span(std::string_view s, uint16_t mask)
+{
+	size_t i = 0;
+
+    while (i < s.length() && chr::is(s[i], mask))
+	i++;
+    return i;
+}; /* scalar_span() */
+
+size_t cctype_span(std::string_view s)
+{
+	size_t i = 0;
+
+    while (i < s.length() && std::isspace(static_cast<unsigned char>(s[i])))
+	i++;
+    return i;
+}; /* cctype_span() */
+
+}; /* namespace */
+
+
+static void BM_span_swar(benchmark::State& state)
+{
+	std::string s = sample(state.range(0), ' ');
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(chr::span(s, chr::space));
+    state.SetBytesProcessed(state.iterations() * s.length());
+}; /* BM_span_swar() */
+BENCHMARK(BM_span_swar)->Arg(8)->Arg(4096);
+
+static void BM_span_table(benchmark::State& state)
+{
+	std::string s = sample(state.range(0), ' ');
+
+    for (auto _: state)
+    {
+	benchmark::DoNotOptimize(s.data());
+	benchmark::DoNotOptimize(scalar_span(s, chr::space));
+    }
+    state.SetBytesProcessed(state.iterations() * s.length());
+}; /* BM_span_table() */
+BENCHMARK(BM_span_table)->Arg(8)->Arg(4096);
+
+static void BM_span_cctype(benchmark::State& state)
+{
+	std::string s = sample(state.range(0), ' ');
+
+    for (auto _: state)
+    {
+	benchmark::DoNotOptimize(s.data());
+	benchmark::DoNotOptimize(cctype_span(s));
+    }
+    state.SetBytesProcessed(state.iterations() * s.length());
+}; /* BM_span_cctype() */
+BENCHMARK(BM_span_cctype)->Arg(8)->Arg(4096);
+
+static void BM_rspan_swar(benchmark::State& state)
+{
+	std::string s = sample(state.range(0), ' ');
+
+    s.front() = 'x';
+    s.back() = ' ';
+    for (auto _: state)
+	benchmark::DoNotOptimize(chr::rspan(s, chr::space));
+    state.SetBytesProcessed(state.iterations() * s.length());
+}; /* BM_rspan_swar() */
+BENCHMARK(BM_rspan_swar)->Arg(8)->Arg(4096);
+
+static void BM_is_digitex(benchmark::State& state)
+{
+	std::string s(state.range(0), '7');
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(astr::is_digitex(s));
+    state.SetBytesProcessed(state.iterations() * s.length());
+}; /* BM_is_digitex() */
+BENCHMARK(BM_is_digitex)->Arg(8)->Arg(4096);
+
+static void BM_is_zero(benchmark::State& state)
+{
+	std::string s(state.range(0), '0');
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(astr::is_zero(s));
+    state.SetBytesProcessed(state.iterations() * s.length());
+}; /* BM_is_zero() */
+BENCHMARK(BM_is_zero)->Arg(8)->Arg(4096);
+
+BENCHMARK_MAIN();
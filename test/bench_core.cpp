@@ -0,0 +1,209 @@
+/*!@file bench_core.cpp
+ *
+ * @brief Benchmarks of the core utils: string trimming & the answer words, semaphore round-trips,
+ *	  the event dispatch through the event::ctrl<>::implement_handler and through the event loop
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <string>
+
+#include "asemaphore"
+#include "astring.h"
+#include "event_ctrl.hpp"
+
+
+static void BM_trim(benchmark::State& state)
+{
+	const std::string src = "   \t some value with spaces \r\n  ";
+
+    for (auto _: state)
+    {
+	std::string s = src;
+	benchmark::DoNotOptimize(astr::trim(s));
+    }
+}; /* BM_trim() */
+BENCHMARK(BM_trim);
+
+static void BM_trimmed(benchmark::State& state)
+{
+	const std::string src = "   \t some value with spaces \r\n  ";
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(astr::trimmed(src));
+}; /* BM_trimmed() */
+BENCHMARK(BM_trimmed);
+
+static void BM_trimmed_view(benchmark::State& state)
+{
+	const std::string_view src = "   \t some value with spaces \r\n  ";
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(astr::trimmed(src));
+}; /* BM_trimmed_view() */
+BENCHMARK(BM_trimmed_view);
+
+
+static void BM_confirm(benchmark::State& state)
+{
+	const char* words[] = {"yes", "On", "1", "nope", "Enable", "off", "0", "TRUE"};
+	size_t i = 0;
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(astr::confirm(words[i++ % std::size(words)]));
+}; /* BM_confirm() */
+BENCHMARK(BM_confirm);
+
+static void BM_decline(benchmark::State& state)
+{
+	const char* words[] = {"no", "Off", "0", "maybe", "disable", "on", "1", "FALSE"};
+	size_t i = 0;
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(astr::decline(words[i++ % std::size(words)]));
+}; /* BM_decline() */
+BENCHMARK(BM_decline);
+
+
+///@brief uncontended Take/Give of the one task
+static void BM_semaphore_take_give(benchmark::State& state)
+{
+	asemaphore sem;
+
+    sem.Give();
+    for (auto _: state)
+    {
+	sem.Take(0);
+	sem.Give();
+    }
+}; /* BM_semaphore_take_give() */
+BENCHMARK(BM_semaphore_take_give);
+
+///@brief ping-pong of the two tasks over the two binary semaphores
+static void BM_semaphore_ping_pong(benchmark::State& state)
+{
+	static asemaphore ping(false), pong(false);
+	static volatile bool stop;
+
+    stop = false;
+    xTaskCreatePinnedToCore([](void*) {
+	for (;;)
+	{
+	    ping.Take();
+	    if (stop)
+		break;
+	    pong.Give();
+	}
+	pong.Give();
+	vTaskDelete(nullptr);
+    }, "pong", 4096, nullptr, 5, nullptr, tskNO_AFFINITY);
+
+    for (auto _: state)
+    {
+	ping.Give();
+	pong.Take();
+    }
+    stop = true;
+    ping.Give();
+    pong.Take();
+}; /* BM_semaphore_ping_pong() */
+BENCHMARK(BM_semaphore_ping_pong)->UseRealTime();
+
+
+namespace
+{
+
+struct counting: event::handler::base
+{
+    using base::base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void*) override { hits++; };
+
+    uint64_t hits = 0;
+}; /* struct counting */
+
+ESP_EVENT_DEFINE_BASE(BENCH_EVENT);
+
+counting counter(BENCH_EVENT, 1);
+
+///@brief access to the protected dispatch trampoline
+struct direct: event::ctrl<counter>
+{
+    using ctrl::implement_handler;
+}; /* struct direct */
+
+}; /* namespace */
+
+
+static void BM_ctrl_implement_handler(benchmark::State& state)
+{
+	int payload = 0;
+
+    for (auto _: state)
+    {
+	direct::implement_handler(nullptr, BENCH_EVENT, 1, &payload);
+	benchmark::ClobberMemory();
+    }
+}; /* BM_ctrl_implement_handler() */
+BENCHMARK(BM_ctrl_implement_handler);
+
+///@brief post to the loop w/o the task & dispatch by the esp_event_loop_run() in the same task
+static void BM_ctrl_post_run(benchmark::State& state)
+{
+	esp_event_loop_args_t args = {8, nullptr, 0, 0, 0};
+	esp_event_loop_handle_t loop;
+	int payload = 0;
+
+    esp_event_loop_create(&args, &loop);
+    event::ctrl<counter>::enroll_to(loop);
+    for (auto _: state)
+    {
+	esp_event_post_to(loop, BENCH_EVENT, 1, &payload, sizeof(payload), 0);
+	esp_event_loop_run(loop, 0);
+    }
+    event::ctrl<counter>::unreg_from(loop);
+    esp_event_loop_delete(loop);
+}; /* BM_ctrl_post_run() */
+BENCHMARK(BM_ctrl_post_run);
+
+
+namespace
+{
+
+struct releasing: event::handler::base
+{
+    using base::base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void*) override { done.Give(); };
+
+    asemaphore done {false};
+}; /* struct releasing */
+
+releasing release(BENCH_EVENT, 2);
+
+}; /* namespace */
+
+///@brief post to the loop with the task & wait for the handler: the dispatch latency of the loop
+static void BM_ctrl_post_latency(benchmark::State& state)
+{
+	esp_event_loop_args_t args = {8, "bench_loop", 5, 4096, tskNO_AFFINITY};
+	esp_event_loop_handle_t loop;
+
+    esp_event_loop_create(&args, &loop);
+    event::ctrl<release>::enroll_to(loop);
+    for (auto _: state)
+    {
+	esp_event_post_to(loop, BENCH_EVENT, 2, nullptr, 0, portMAX_DELAY);
+	release.done.Take();
+    }
+    event::ctrl<release>::unreg_from(loop);
+    esp_event_loop_delete(loop);
+}; /* BM_ctrl_post_latency() */
+BENCHMARK(BM_ctrl_post_latency)->UseRealTime();
+
+BENCHMARK_MAIN();
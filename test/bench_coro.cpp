@@ -0,0 +1,117 @@
+/*!@file bench_coro.cpp
+ *
+ * @brief Resume latency of the coroutine at the executor task against the wake-up of the task per session:
+ *	  the round trip Give -> resumed -> Give back
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <thread>
+
+#include "asemaphore"
+#include "amutex"
+#include "event_ctrl.hpp"
+#include "coro.hpp"
+
+
+using aso::coro::async;
+using aso::coro::executor;
+using aso::coro::task;
+
+namespace
+{
+
+///@brief the session coroutine: waits for the ping & gives the pong back; the stop is checked after the ping,
+/// so the last ping is answered too
+task session(async<asemaphore>& ping, asemaphore& pong, std::atomic<bool>& stop)
+{
+    for (;;)
+    {
+	co_await ping.async_take();
+	if (stop)
+	    break;
+	pong.Give();
+    }
+    pong.Give();
+}; /* session() */
+
+}; /* namespace */
+
+
+static void BM_coro_resume(benchmark::State& state)
+{
+	executor exec(8);
+	async<asemaphore> ping(false);
+	asemaphore pong(false);
+	std::atomic<bool> stop {false};
+
+    exec.spawn(session(ping, pong, stop));
+    exec.start("bench_coro");
+    for (auto _: state)
+    {
+	ping.Give();
+	pong.Take();
+    }
+    stop = true;
+    ping.Give();
+    pong.Take();
+}; /* BM_coro_resume() */
+BENCHMARK(BM_coro_resume)->UseRealTime();
+
+///@brief the former way: the task per session, blocked on the semaphore
+static void BM_task_wakeup(benchmark::State& state)
+{
+	asemaphore ping(false), pong(false);
+	std::atomic<bool> stop {false};
+	std::thread session([&] {
+	    while (!stop)
+	    {
+		ping.Take();
+		pong.Give();
+	    }
+	});
+
+    for (auto _: state)
+    {
+	ping.Give();
+	pong.Take();
+    }
+    stop = true;
+    ping.Give();
+    session.join();
+}; /* BM_task_wakeup() */
+BENCHMARK(BM_task_wakeup)->UseRealTime();
+
+///@brief the executor, driven by the same task: the bare cost of the schedule & resume, w/o the context switch
+static void BM_coro_resume_inline(benchmark::State& state)
+{
+	executor exec(8);
+	async<asemaphore> ping(false);
+	asemaphore pong(false);
+	std::atomic<bool> stop {false};
+
+    exec.spawn(session(ping, pong, stop));
+    exec.run_once(0);
+    for (auto _: state)
+    {
+	ping.Give();
+	exec.run_once(0);
+	pong.Take(0);
+    }
+    stop = true;
+    ping.Give();
+    exec.run_once(0);
+}; /* BM_coro_resume_inline() */
+BENCHMARK(BM_coro_resume_inline);
+
+BENCHMARK_MAIN();
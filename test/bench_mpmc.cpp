@@ -0,0 +1,161 @@
+/*!@file bench_mpmc.cpp
+ *
+ * @brief Scalability of the MPMC queue against the mutex-protected deque: 1..8 producer & 1..8 consumer threads
+ *	  pass the 32-bit items, both non-blocking (yield on the empty/full queue) & blocking variants
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "asemaphore"
+#include "blocking.hpp"
+#include "mpmc_queue.hpp"
+
+
+namespace
+{
+
+constexpr size_t depth = 256;
+constexpr uint32_t batch = 40320;	///< items per the benchmark iteration: divisible by 1..8
+
+///@brief the baseline: the deque under the mutex, bounded by the depth
+class locked_deque
+{
+public:
+    bool push(uint32_t v) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (items.size() >= depth)
+	    return false;
+	items.push_back(v);
+	return true; };
+
+    bool pop(uint32_t& v) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (items.empty())
+	    return false;
+	v = items.front();
+	items.pop_front();
+	return true; };
+
+    static constexpr size_t capacity() { return depth; };
+
+protected:
+    std::mutex lock;
+    std::deque<uint32_t> items;
+}; /* class locked_deque */
+
+///@brief the blocking baseline: the counting semaphores of the free slots & of the items around the locked deque
+class semaphore_deque: protected locked_deque
+{
+public:
+    bool push_wait(uint32_t v) {
+	slots.Take();
+	locked_deque::push(v);
+	return items_count.Give() == pdTRUE; };
+
+    bool pop_wait(uint32_t& v) {
+	items_count.Take();
+	locked_deque::pop(v);
+	return slots.Give() == pdTRUE; };
+
+protected:
+    asemaphore slots {depth, depth};
+    asemaphore items_count {depth, 0};
+}; /* class semaphore_deque */
+
+///@brief producers & consumers pass the batch by the non-blocking push/pop, yield on the full/empty queue
+template <typename Queue>
+void spinning(benchmark::State& state)
+{
+	const unsigned producers = state.range(0), consumers = state.range(1);
+	Queue queue;
+
+    for (auto _: state)
+    {
+	    std::vector<std::thread> threads;
+
+	for (unsigned c = 0; c < consumers; c++)
+	    threads.emplace_back([&] {
+		for (uint32_t n = 0, v; n < batch / consumers;)
+		    if (queue.pop(v))
+			n++;
+		    else
+			std::this_thread::yield();
+	    });
+	for (unsigned p = 0; p < producers; p++)
+	    threads.emplace_back([&] {
+		for (uint32_t i = 0; i < batch / producers;)
+		    if (queue.push(i))
+			i++;
+		    else
+			std::this_thread::yield();
+	    });
+	for (auto& t: threads)
+	    t.join();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}; /* spinning() */
+
+///@brief producers & consumers pass the batch by the blocking push_wait/pop_wait
+template <typename Queue>
+void waiting(benchmark::State& state)
+{
+	const unsigned producers = state.range(0), consumers = state.range(1);
+	Queue queue;
+
+    for (auto _: state)
+    {
+	    std::vector<std::thread> threads;
+
+	for (unsigned c = 0; c < consumers; c++)
+	    threads.emplace_back([&] {
+		for (uint32_t n = 0, v; n < batch / consumers; n++)
+		    queue.pop_wait(v);
+	    });
+	for (unsigned p = 0; p < producers; p++)
+	    threads.emplace_back([&] {
+		for (uint32_t i = 0; i < batch / producers; i++)
+		    queue.push_wait(i);
+	    });
+	for (auto& t: threads)
+	    t.join();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}; /* waiting() */
+
+void threads_args(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"producers", "consumers"});
+    for (int p: {1, 2, 4, 8})
+	for (int c: {1, 2, 4, 8})
+	    b->Args({p, c});
+    b->UseRealTime();
+}; /* threads_args() */
+
+}; /* namespace */
+
+
+static void BM_mpmc(benchmark::State& state) { spinning<aso::mpmc_queue<uint32_t, depth>>(state); };
+BENCHMARK(BM_mpmc)->Apply(threads_args);
+
+static void BM_mutex_deque(benchmark::State& state) { spinning<locked_deque>(state); };
+BENCHMARK(BM_mutex_deque)->Apply(threads_args);
+
+static void BM_mpmc_blocking(benchmark::State& state) { waiting<aso::blocking<aso::mpmc_queue<uint32_t, depth>>>(state); };
+BENCHMARK(BM_mpmc_blocking)->Apply(threads_args);
+
+static void BM_semaphore_deque(benchmark::State& state) { waiting<semaphore_deque>(state); };
+BENCHMARK(BM_semaphore_deque)->Apply(threads_args);
+
+BENCHMARK_MAIN();
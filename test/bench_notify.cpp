@@ -0,0 +1,77 @@
+/*!@file bench_notify.cpp
+ *
+ * @brief Wake-up latency of the asemaphore::notify against the binary semaphores: ping-pong of the two tasks
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <thread>
+
+#include "asemaphore"
+
+
+namespace
+{
+
+///@brief round trip: the main task gives ping & takes pong, the partner takes ping & gives pong
+template <typename Ping, typename Pong>
+void ping_pong(benchmark::State& state, Ping& ping, Pong& pong)
+{
+	std::atomic<bool> stop {false};
+	std::thread partner([&] {
+	    for (;;)
+	    {
+		ping.Take();
+		if (stop)
+		    break;
+		pong.Give();
+	    }
+	});
+
+    for (auto _: state)
+    {
+	ping.Give();
+	pong.Take();
+    }
+    stop = true;
+    ping.Give();
+    partner.join();
+}; /* ping_pong() */
+
+}; /* namespace */
+
+
+static void BM_binary_semaphore(benchmark::State& state)
+{
+	asemaphore ping(false), pong(false);
+
+    ping_pong(state, ping, pong);
+}; /* BM_binary_semaphore() */
+BENCHMARK(BM_binary_semaphore)->UseRealTime();
+
+static void BM_static_semaphore(benchmark::State& state)
+{
+	asemaphore::stat ping(false), pong(false);
+
+    ping_pong(state, ping, pong);
+}; /* BM_static_semaphore() */
+BENCHMARK(BM_static_semaphore)->UseRealTime();
+
+///@brief both semaphores are bound at the first Take by the waiting task
+static void BM_notify(benchmark::State& state)
+{
+	asemaphore::notify ping(nullptr), pong;
+
+    ping_pong(state, ping, pong);
+}; /* BM_notify() */
+BENCHMARK(BM_notify)->UseRealTime();
+
+BENCHMARK_MAIN();
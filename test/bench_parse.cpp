@@ -0,0 +1,90 @@
+/*!@file bench_parse.cpp
+ *
+ * @brief Values parsing by the astr::parse<T> against the std::strtol/strtod on NUL-terminated copies
+ *	  & the bare std::from_chars
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <charconv>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include "astring.h"
+
+
+namespace
+{
+
+const std::string_view integers[] = {"42", "-1000", "0x7fff", "123456789", "0", "-7", "65535", "1000000"};
+const std::string_view reals[] = {"1.5", "-0.25", "3.14159", "1e3", "2.5e-2", "100", "0.001", "6.02e23"};
+
+}; /* namespace */
+
+
+static void BM_parse_int(benchmark::State& state)
+{
+	size_t i = 0;
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(astr::parse<long>(integers[i++ % std::size(integers)]));
+}; /* BM_parse_int() */
+BENCHMARK(BM_parse_int);
+
+///@brief the string_view must be copied to be NUL-terminated for the strtol
+static void BM_strtol(benchmark::State& state)
+{
+	size_t i = 0;
+
+    for (auto _: state)
+    {
+	    std::string s(integers[i++ % std::size(integers)]);
+
+	benchmark::DoNotOptimize(strtol(s.c_str(), nullptr, 0));
+    }
+}; /* BM_strtol() */
+BENCHMARK(BM_strtol);
+
+static void BM_parse_double(benchmark::State& state)
+{
+	size_t i = 0;
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(astr::parse<double>(reals[i++ % std::size(reals)]));
+}; /* BM_parse_double() */
+BENCHMARK(BM_parse_double);
+
+static void BM_strtod(benchmark::State& state)
+{
+	size_t i = 0;
+
+    for (auto _: state)
+    {
+	    std::string s(reals[i++ % std::size(reals)]);
+
+	benchmark::DoNotOptimize(strtod(s.c_str(), nullptr));
+    }
+}; /* BM_strtod() */
+BENCHMARK(BM_strtod);
+
+///@brief the floor: the bare conversion w/o the validation & the separators
+static void BM_from_chars_double(benchmark::State& state)
+{
+	size_t i = 0;
+	double value;
+
+    for (auto _: state)
+    {
+	    std::string_view s = reals[i++ % std::size(reals)];
+
+	benchmark::DoNotOptimize(std::from_chars(s.data(), s.data() + s.length(), value));
+	benchmark::DoNotOptimize(value);
+    }
+}; /* BM_from_chars_double() */
+BENCHMARK(BM_from_chars_double);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+/*!@file bench_pool.cpp
+ *
+ * @brief Fixed-block pool against the malloc: alloc/free throughput & the heap fragmentation
+ *	  (by the mallinfo2) of the mixed workload of the long-lived small objects & the short-lived buffers
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+
+#include <malloc.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "pool.hpp"
+
+
+namespace
+{
+
+constexpr size_t small = 32;		///< size of the long-lived objects
+constexpr size_t count = 1024;		///< count of the long-lived objects
+
+}; /* namespace */
+
+
+static void BM_pool_alloc_free(benchmark::State& state)
+{
+	aso::pool_resource::stat<small, count> pool;
+
+    for (auto _: state)
+    {
+	    void* ptr = pool.allocate_block();
+
+	benchmark::DoNotOptimize(ptr);
+	pool.free_block(ptr);
+    }
+}; /* BM_pool_alloc_free() */
+BENCHMARK(BM_pool_alloc_free);
+
+static void BM_malloc_free(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+	    void* ptr = malloc(small);
+
+	benchmark::DoNotOptimize(ptr);
+	free(ptr);
+    }
+}; /* BM_malloc_free() */
+BENCHMARK(BM_malloc_free);
+
+
+///@brief allocate the batch & free it in the random order
+template <bool Pool>
+static void BM_batch(benchmark::State& state)
+{
+	aso::pool_resource::stat<small, count> pool;
+	std::vector<void*> blocks(count);
+	std::vector<size_t> order(count);
+	std::mt19937 rnd(1);
+
+    for (size_t i = 0; i < count; i++)
+	order[i] = i;
+    std::shuffle(order.begin(), order.end(), rnd);
+    for (auto _: state)
+    {
+	for (void*& ptr: blocks)
+	    ptr = Pool? pool.allocate_block(): malloc(small);
+	for (size_t i: order)
+	    if (Pool)
+		pool.free_block(blocks[i]);
+	    else
+		free(blocks[i]);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}; /* BM_batch() */
+BENCHMARK(BM_batch<true>)->Name("BM_pool_batch");
+BENCHMARK(BM_batch<false>)->Name("BM_malloc_batch");
+
+
+///@brief the long-lived small objects, interleaved with the short-lived buffers: after the buffers are freed
+/// the heap can't be trimmed, the small objects pin the holes; reported after the buffers are freed:
+/// the heap growth (held), the bytes in use (used) & the free bytes in the holes (holes)
+template <bool Pool>
+static void BM_fragmentation(benchmark::State& state)
+{
+	constexpr size_t buffer = 1024;
+	struct mallinfo2 before = {}, after = {};
+
+    for (auto _: state)
+    {
+	    aso::pool_resource pool(small, count);
+	    std::vector<void*> objects, buffers;
+
+	objects.reserve(count);
+	buffers.reserve(count);
+	malloc_trim(0);
+	before = mallinfo2();
+	for (size_t i = 0; i < count; i++)
+	{
+	    buffers.push_back(malloc(buffer));
+	    objects.push_back(Pool? pool.allocate_block(): malloc(small));
+	}
+	for (void* ptr: buffers)
+	    free(ptr);
+	malloc_trim(0);
+	after = mallinfo2();
+	for (void* ptr: objects)
+	    if (Pool)
+		pool.free_block(ptr);
+	    else
+		free(ptr);
+    }
+    state.counters["held_KB"] = (double(after.arena) - double(before.arena)) / 1024;
+    state.counters["used_KB"] = (double(after.uordblks) - double(before.uordblks)) / 1024;
+    state.counters["holes_KB"] = (double(after.fordblks) - double(before.fordblks)) / 1024;
+}; /* BM_fragmentation() */
+BENCHMARK(BM_fragmentation<true>)->Name("BM_pool_fragmentation")->Iterations(10);
+BENCHMARK(BM_fragmentation<false>)->Name("BM_malloc_fragmentation")->Iterations(10);
+
+BENCHMARK_MAIN();
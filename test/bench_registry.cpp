@@ -0,0 +1,146 @@
+/*!@file bench_registry.cpp
+ *
+ * @brief Benchmarks of the event::registry against the event::ctrl<>: the bare trampoline call,
+ *	  the post & dispatch through the local loop, the register/unregister cycle
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+
+#include "event_ctrl.hpp"
+#include "event_registry.hpp"
+
+
+namespace
+{
+
+struct counting: event::handler::base
+{
+    using base::base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void*) override { hits++; };
+
+    uint64_t hits = 0;
+}; /* struct counting */
+
+ESP_EVENT_DEFINE_BASE(BENCH_EVENT);
+
+counting counter(BENCH_EVENT, 1);
+
+///@brief access to the protected dispatch trampoline of the ctrl
+struct direct_ctrl: event::ctrl<counter>
+{
+    using ctrl::implement_handler;
+}; /* struct direct_ctrl */
+
+///@brief access to the protected shared trampoline of the registry
+struct direct_registry: event::registry<16>
+{
+    using registry::trampoline;
+}; /* struct direct_registry */
+
+///@brief the loop w/o the task, dispatched by the esp_event_loop_run() in the same task
+esp_event_loop_handle_t local_loop()
+{
+	esp_event_loop_args_t args = {8, nullptr, 0, 0, 0};
+	esp_event_loop_handle_t loop;
+
+    esp_event_loop_create(&args, &loop);
+    return loop;
+}; /* local_loop() */
+
+}; /* namespace */
+
+
+static void BM_ctrl_trampoline(benchmark::State& state)
+{
+	int payload = 0;
+
+    for (auto _: state)
+    {
+	direct_ctrl::implement_handler(nullptr, BENCH_EVENT, 1, &payload);
+	benchmark::ClobberMemory();
+    }
+}; /* BM_ctrl_trampoline() */
+BENCHMARK(BM_ctrl_trampoline);
+
+static void BM_registry_trampoline(benchmark::State& state)
+{
+	int payload = 0;
+	void* arg = &counter;
+
+    for (auto _: state)
+    {
+	benchmark::DoNotOptimize(arg);
+	direct_registry::trampoline(arg, BENCH_EVENT, 1, &payload);
+	benchmark::ClobberMemory();
+    }
+}; /* BM_registry_trampoline() */
+BENCHMARK(BM_registry_trampoline);
+
+
+static void BM_ctrl_post_run(benchmark::State& state)
+{
+	esp_event_loop_handle_t loop = local_loop();
+	int payload = 0;
+
+    event::ctrl<counter>::enroll_to(loop);
+    for (auto _: state)
+    {
+	esp_event_post_to(loop, BENCH_EVENT, 1, &payload, sizeof(payload), 0);
+	esp_event_loop_run(loop, 0);
+    }
+    event::ctrl<counter>::unreg_from(loop);
+    esp_event_loop_delete(loop);
+}; /* BM_ctrl_post_run() */
+BENCHMARK(BM_ctrl_post_run);
+
+static void BM_registry_post_run(benchmark::State& state)
+{
+	esp_event_loop_handle_t loop = local_loop();
+	event::registry<16> reg;
+	int payload = 0;
+
+    {
+	    auto t = reg.enroll_to(loop, counter);
+
+	for (auto _: state)
+	{
+	    esp_event_post_to(loop, BENCH_EVENT, 1, &payload, sizeof(payload), 0);
+	    esp_event_loop_run(loop, 0);
+	}
+    }
+    esp_event_loop_delete(loop);
+}; /* BM_registry_post_run() */
+BENCHMARK(BM_registry_post_run);
+
+
+static void BM_ctrl_enroll_unreg(benchmark::State& state)
+{
+	esp_event_loop_handle_t loop = local_loop();
+
+    for (auto _: state)
+    {
+	event::ctrl<counter>::enroll_to(loop);
+	event::ctrl<counter>::unreg_from(loop);
+    }
+    esp_event_loop_delete(loop);
+}; /* BM_ctrl_enroll_unreg() */
+BENCHMARK(BM_ctrl_enroll_unreg);
+
+static void BM_registry_enroll_unreg(benchmark::State& state)
+{
+	esp_event_loop_handle_t loop = local_loop();
+	event::registry<16> reg;
+
+    for (auto _: state)
+	reg.enroll_to(loop, counter);
+    esp_event_loop_delete(loop);
+}; /* BM_registry_enroll_unreg() */
+BENCHMARK(BM_registry_enroll_unreg);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,120 @@
+/*!@file bench_rwlock.cpp
+ *
+ * @brief Read-mostly contention: N reader tasks & 1 writer task on the shared table,
+ *	  guarded by the arwlock, the amutex & the binary semaphore (the former practice)
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "asemaphore"
+#include "amutex"
+
+
+namespace
+{
+
+///@brief the binary semaphore as the lock, for the comparison
+struct semaphore_lock
+{
+    void lock() { sem.Take(); };
+    void unlock() { sem.Give(); };
+    void lock_shared() { lock(); };
+    void unlock_shared() { unlock(); };
+
+    asemaphore sem {true};
+}; /* struct semaphore_lock */
+
+///@brief the exclusive mutex for the readers too
+struct mutex_lock: amutex
+{
+    void lock_shared() { lock(); };
+    void unlock_shared() { unlock(); };
+}; /* struct mutex_lock */
+
+std::array<int, 16> table;
+
+///@brief read the table; optionally preempted inside of the section, as it is on the loaded system
+int read_table(bool preempted)
+{
+	int sum = 0;
+
+    for (int v: table)
+	sum += v;
+    if (preempted)
+	std::this_thread::yield();
+    return sum;
+}; /* read_table() */
+
+}; /* namespace */
+
+
+///@brief the benchmark task is the one of the N readers; the writer updates the table each 100 us;
+/// args: count of the readers, the readers are preempted inside of the section
+template <typename Lock>
+static void BM_read_mostly(benchmark::State& state)
+{
+	Lock lock;
+	std::atomic<bool> stop {false};
+	std::atomic<uint64_t> reads {0}, writes {0};
+	std::vector<std::thread> tasks;
+	const bool preempted = state.range(1);
+
+    for (int r = 1; r < state.range(0); r++)
+	tasks.emplace_back([&] {
+	    uint64_t n = 0;
+
+	    while (!stop)
+	    {
+		    std::shared_lock guard(lock);
+
+		benchmark::DoNotOptimize(read_table(preempted));
+		n++;
+	    }
+	    reads += n;
+	});
+    tasks.emplace_back([&] {
+	while (!stop)
+	{
+	    {
+		    std::lock_guard guard(lock);
+
+		for (int& v: table)
+		    v++;
+	    }
+	    writes++;
+	    std::this_thread::sleep_for(std::chrono::microseconds(100));
+	}
+    });
+
+    for (auto _: state)
+    {
+	    std::shared_lock guard(lock);
+
+	benchmark::DoNotOptimize(read_table(preempted));
+    }
+    stop = true;
+    for (std::thread& t: tasks)
+	t.join();
+    state.counters["reads"] = benchmark::Counter(state.iterations() + reads, benchmark::Counter::kIsRate);
+    state.counters["writes"] = benchmark::Counter(writes, benchmark::Counter::kIsRate);
+}; /* BM_read_mostly() */
+BENCHMARK(BM_read_mostly<arwlock>)->Name("BM_arwlock")->ArgsProduct({{1, 2, 4}, {0, 1}})->UseRealTime();
+BENCHMARK(BM_read_mostly<mutex_lock>)->Name("BM_amutex")->ArgsProduct({{1, 2, 4}, {0, 1}})->UseRealTime();
+BENCHMARK(BM_read_mostly<semaphore_lock>)->Name("BM_semaphore")->ArgsProduct({{1, 2, 4}, {0, 1}})->UseRealTime();
+
+BENCHMARK_MAIN();
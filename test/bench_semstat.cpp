@@ -0,0 +1,56 @@
+/*!@file bench_semstat.cpp
+ *
+ * @brief Overhead of the per-semaphore statistics: bench_semstat_none & bench_semstat_on are built of this file
+ *	  w/o & with CONFIG_ASO_UTILS_SEMAPHORE_STATS
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "asemaphore"
+
+
+///@brief the uncontended take & give: the fast path of the every lock
+static void BM_take_give(benchmark::State& state)
+{
+	asemaphore sem(true);
+
+    for (auto _: state)
+    {
+	sem.Take(0);
+	sem.Give();
+    }
+}; /* BM_take_give() */
+BENCHMARK(BM_take_give);
+
+///@brief the failed take w/o waiting: the polling of the closed semaphore
+static void BM_take_timeout(benchmark::State& state)
+{
+	asemaphore sem(false);
+
+    for (auto _: state)
+	benchmark::DoNotOptimize(sem.Take(0));
+}; /* BM_take_timeout() */
+BENCHMARK(BM_take_timeout);
+
+///@brief the batch of 8 units of the counting semaphore
+static void BM_batch(benchmark::State& state)
+{
+	asemaphore sem(8, 0);
+
+    for (auto _: state)
+    {
+	sem.Give(8);
+	sem.Take(8, 0);
+    }
+    state.SetItemsProcessed(state.iterations() * 8);
+}; /* BM_batch() */
+BENCHMARK(BM_batch);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,97 @@
+/*!@file bench_spsc.cpp
+ *
+ * @brief Throughput of the SPSC ring against the FreeRTOS queue: the producer & the consumer tasks
+ *	  pass the 32-bit samples
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <thread>
+
+#include "asemaphore"
+#include "blocking.hpp"
+#include "spsc_ring.hpp"
+
+
+namespace
+{
+
+constexpr size_t depth = 256;
+constexpr uint32_t batch = 100000;	///< samples per the benchmark iteration
+
+}; /* namespace */
+
+
+///@brief the lock-free ring, both sides spin (yield) on the empty/full ring
+static void BM_spsc_ring(benchmark::State& state)
+{
+	aso::spsc_ring<uint32_t, depth> ring;
+
+    for (auto _: state)
+    {
+	std::thread consumer([&] {
+	    for (uint32_t n = 0, v; n < batch;)
+		if (ring.pop(v))
+		    n++;
+		else
+		    std::this_thread::yield();
+	});
+	for (uint32_t i = 0; i < batch;)
+	    if (ring.push(i))
+		i++;
+	    else
+		std::this_thread::yield();
+	consumer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}; /* BM_spsc_ring() */
+BENCHMARK(BM_spsc_ring)->UseRealTime();
+
+///@brief the ring with the blocking adapter: the semaphores are touched on the empty/full edges only
+static void BM_spsc_ring_blocking(benchmark::State& state)
+{
+	aso::blocking<aso::spsc_ring<uint32_t, depth>> ring;
+
+    for (auto _: state)
+    {
+	std::thread consumer([&] {
+	    for (uint32_t n = 0, v; n < batch; n++)
+		ring.pop_wait(v);
+	});
+	for (uint32_t i = 0; i < batch; i++)
+	    ring.push_wait(i);
+	consumer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}; /* BM_spsc_ring_blocking() */
+BENCHMARK(BM_spsc_ring_blocking)->UseRealTime();
+
+///@brief the FreeRTOS queue: xQueueSend/xQueueReceive per the sample
+static void BM_xqueue(benchmark::State& state)
+{
+	QueueHandle_t queue = xQueueCreate(depth, sizeof(uint32_t));
+
+    for (auto _: state)
+    {
+	std::thread consumer([&] {
+	    for (uint32_t n = 0, v; n < batch; n++)
+		xQueueReceive(queue, &v, portMAX_DELAY);
+	});
+	for (uint32_t i = 0; i < batch; i++)
+	    xQueueSend(queue, &i, portMAX_DELAY);
+	consumer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+    vQueueDelete(queue);
+}; /* BM_xqueue() */
+BENCHMARK(BM_xqueue)->UseRealTime();
+
+BENCHMARK_MAIN();
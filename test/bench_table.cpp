@@ -0,0 +1,102 @@
+/*!@file bench_table.cpp
+ *
+ * @brief Dispatch time against the handler count: the event::table with the one registration per event base
+ *	  against the event::ctrl<> registration of the every handler, 1..64 handlers on the local loop
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+
+#include <utility>
+
+#include "event_ctrl.hpp"
+#include "event_table.hpp"
+
+
+ESP_EVENT_DEFINE_BASE(TABLE_BENCH_EVENT);
+
+namespace
+{
+
+struct counting: event::handler::base
+{
+    using base::base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void*) override { hits++; };
+
+    uint64_t hits = 0;
+}; /* struct counting */
+
+///@brief the handler of the event id I
+template <int I>
+counting handler(TABLE_BENCH_EVENT, I);
+
+///@brief the loop w/o the task, dispatched by the esp_event_loop_run() in the same task
+esp_event_loop_handle_t local_loop()
+{
+	esp_event_loop_args_t args = {8, nullptr, 0, 0, 0};
+	esp_event_loop_handle_t loop;
+
+    esp_event_loop_create(&args, &loop);
+    return loop;
+}; /* local_loop() */
+
+///@brief post the event of the middle id & dispatch it
+void post_run(benchmark::State& state, esp_event_loop_handle_t loop, int32_t id)
+{
+	int payload = 0;
+
+    for (auto _: state)
+    {
+	esp_event_post_to(loop, TABLE_BENCH_EVENT, id, &payload, sizeof(payload), 0);
+	esp_event_loop_run(loop, 0);
+    }
+}; /* post_run() */
+
+///@brief every handler is registered by the own event::ctrl<>
+template <int... I>
+void ctrl_dispatch(benchmark::State& state, std::integer_sequence<int, I...>)
+{
+	esp_event_loop_handle_t loop = local_loop();
+
+    (event::ctrl<handler<I>>::enroll_to(loop), ...);
+    post_run(state, loop, sizeof...(I) / 2);
+    (event::ctrl<handler<I>>::unreg_from(loop), ...);
+    esp_event_loop_delete(loop);
+}; /* ctrl_dispatch() */
+
+///@brief the handlers are registered by the one event::table
+template <int... I>
+void table_dispatch(benchmark::State& state, std::integer_sequence<int, I...>)
+{
+	using table = event::table<handler<I>...>;
+	esp_event_loop_handle_t loop = local_loop();
+
+    table::enroll_to(loop);
+    post_run(state, loop, sizeof...(I) / 2);
+    table::unreg();
+    esp_event_loop_delete(loop);
+}; /* table_dispatch() */
+
+}; /* namespace */
+
+
+template <int N>
+static void BM_ctrl_dispatch(benchmark::State& state) { ctrl_dispatch(state, std::make_integer_sequence<int, N>()); };
+BENCHMARK(BM_ctrl_dispatch<1>);
+BENCHMARK(BM_ctrl_dispatch<4>);
+BENCHMARK(BM_ctrl_dispatch<16>);
+BENCHMARK(BM_ctrl_dispatch<64>);
+
+template <int N>
+static void BM_table_dispatch(benchmark::State& state) { table_dispatch(state, std::make_integer_sequence<int, N>()); };
+BENCHMARK(BM_table_dispatch<1>);
+BENCHMARK(BM_table_dispatch<4>);
+BENCHMARK(BM_table_dispatch<16>);
+BENCHMARK(BM_table_dispatch<64>);
+
+BENCHMARK_MAIN();
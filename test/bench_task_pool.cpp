@@ -0,0 +1,105 @@
+/*!@file bench_task_pool.cpp
+ *
+ * @brief Scaling of the parallel reduction on the work-stealing task pool: 1..8 workers against the serial loop,
+ *	  the memory-bound sum & the compute-bound sum of the per-element work
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+#include "asemaphore"
+#include "task_pool.hpp"
+
+
+namespace
+{
+
+constexpr size_t elements = 1 << 20;
+constexpr size_t grain = 1 << 14;
+
+const std::vector<uint32_t>& data()
+{
+	static std::vector<uint32_t> values = [] {
+	    std::vector<uint32_t> v(elements);
+	    std::iota(v.begin(), v.end(), 0u);
+	    return v; }();
+
+    return values;
+}; /* data() */
+
+///@brief the memory-bound element: the value itself
+inline uint64_t light(uint32_t v) { return v; };
+
+///@brief the compute-bound element: some filter-like work per the sample
+inline uint64_t heavy(uint32_t v)
+{
+	float x = float(v & 0xFFFF) * 1e-4f;
+
+    for (int i = 0; i < 4; i++)
+	x = x * 0.97f + std::sin(x) * 0.03f;
+    return uint64_t(x * 1000.f);
+}; /* heavy() */
+
+template <uint64_t (*Element)(uint32_t)>
+uint64_t serial_sum(size_t b, size_t e)
+{
+	const auto& v = data();
+	uint64_t sum = 0;
+
+    for (size_t i = b; i < e; i++)
+	sum += Element(v[i]);
+    return sum;
+}; /* serial_sum() */
+
+template <uint64_t (*Element)(uint32_t)>
+void serial(benchmark::State& state)
+{
+    for (auto _: state)
+	benchmark::DoNotOptimize(serial_sum<Element>(0, elements));
+    state.SetItemsProcessed(state.iterations() * elements);
+}; /* serial() */
+
+template <uint64_t (*Element)(uint32_t)>
+void pooled(benchmark::State& state)
+{
+	aso::task_pool pool(state.range(0));
+
+    data();
+    for (auto _: state)
+    {
+	    std::atomic<uint64_t> sum {0};
+
+	pool.parallel_for(0, elements, grain, [&sum](size_t b, size_t e) {
+	    sum.fetch_add(serial_sum<Element>(b, e), std::memory_order_relaxed); });
+	benchmark::DoNotOptimize(sum.load());
+    }
+    state.SetItemsProcessed(state.iterations() * elements);
+}; /* pooled() */
+
+}; /* namespace */
+
+
+static void BM_sum_serial(benchmark::State& state) { serial<light>(state); };
+BENCHMARK(BM_sum_serial)->UseRealTime();
+
+static void BM_sum_pool(benchmark::State& state) { pooled<light>(state); };
+BENCHMARK(BM_sum_pool)->ArgName("workers")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+static void BM_heavy_serial(benchmark::State& state) { serial<heavy>(state); };
+BENCHMARK(BM_heavy_serial)->UseRealTime();
+
+static void BM_heavy_pool(benchmark::State& state) { pooled<heavy>(state); };
+BENCHMARK(BM_heavy_pool)->ArgName("workers")->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+BENCHMARK_MAIN();
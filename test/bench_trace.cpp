@@ -0,0 +1,66 @@
+/*!@file bench_trace.cpp
+ *
+ * @brief Take/Give latency of the asemaphore with the tracing selected at the build:
+ *	  bench_trace_none, bench_trace_ring & bench_trace_log are built of this file
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+
+#include <esp_log.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "asemaphore"
+#include "trace.hpp"
+
+
+namespace
+{
+
+///@brief the text log is formatted completely, but is not printed
+int discard(const char* fmt, va_list args)
+{
+	static FILE* null = std::fopen("/dev/null", "w");
+
+    return std::vfprintf(null, fmt, args);
+}; /* discard() */
+
+#if CONFIG_ASO_UTILS_TRACE_RING
+///@brief keep the ring drained, as the consumer task does
+void drain()
+{
+	aso::trace::record buf[CONFIG_ASO_UTILS_TRACE_RING_SIZE];
+
+    aso::trace::drain(buf, CONFIG_ASO_UTILS_TRACE_RING_SIZE);
+}; /* drain() */
+#else
+void drain() {};
+#endif	// CONFIG_ASO_UTILS_TRACE_RING
+
+}; /* namespace */
+
+
+static void BM_take_give(benchmark::State& state)
+{
+	asemaphore sem(true);
+	vprintf_like_t prev = esp_log_set_vprintf(discard);
+	unsigned n = 0;
+
+    for (auto _: state)
+    {
+	sem.Take(0);
+	sem.Give();
+	if (++n % 16 == 0)
+	    drain();
+    }
+    esp_log_set_vprintf(prev);
+}; /* BM_take_give() */
+BENCHMARK(BM_take_give);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,15 @@
+/*!@file esp_attr.h
+ *
+ * @brief Host stand-in of the ESP-IDF memory placement attributes: no special sections on the host
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define NOINLINE_ATTR __attribute__((noinline))
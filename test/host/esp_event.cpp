@@ -0,0 +1,372 @@
+/*!@file esp_event.cpp
+ *
+ * @brief Host stand-in of the ESP-IDF event loop library: the bounded queue of the posted event copies,
+ *	  dispatched by the loop task or by the esp_event_loop_run(); the handlers are called in the IDF order:
+ *	  the any-base ones, then the base-wide, then the exact ones, each group in the registration order
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <esp_event.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace
+{
+
+using clock = std::chrono::steady_clock;
+
+struct handler
+{
+    esp_event_base_t base;
+    int32_t id;
+    esp_event_handler_t fn;
+    void* arg;
+    bool legacy;			///< registered by the esp_event_handler_register*()
+    bool alive = true;
+
+    ///@brief matching group of the IDF dispatching order: 0 - any base, 1 - any id of the base, 2 - exact
+    int group() const { return !base? 0: id == ESP_EVENT_ANY_ID? 1: 2; };
+
+    bool match(esp_event_base_t b, int32_t i) const
+    {
+	return !base || (base == b && (id == ESP_EVENT_ANY_ID || id == i));
+    };
+}; /* struct handler */
+
+struct posted
+{
+    esp_event_base_t base;
+    int32_t id;
+    std::vector<uint8_t> data;
+}; /* struct posted */
+
+struct loop
+{
+    const size_t depth;
+    std::mutex lock;			///< the queue lock
+    std::condition_variable readable, writable, stopped;
+    std::deque<posted> queue;
+
+    std::recursive_mutex dispatching;	///< held while the handlers run & while the handlers list is changed
+    std::list<std::shared_ptr<handler>> handlers;
+
+    TaskHandle_t task = nullptr;
+    bool stop = false;
+    bool running = false;
+
+    explicit loop(size_t d): depth(d) {};
+}; /* struct loop */
+
+loop* default_loop = nullptr;
+
+
+clock::time_point deadline(TickType_t ticks)
+{
+    return clock::now() + std::chrono::milliseconds(uint64_t(ticks) * 1000 / configTICK_RATE_HZ);
+}; /* deadline() */
+
+///@brief call the matching handlers of the one event
+void dispatch(loop& l, const posted& ev)
+{
+	std::lock_guard<std::recursive_mutex> guard(l.dispatching);
+	std::vector<std::shared_ptr<handler>> matched;
+
+    for (int group = 0; group < 3; group++)
+	for (auto& h: l.handlers)
+	    if (h->group() == group && h->match(ev.base, ev.id))
+		matched.push_back(h);
+    // the handlers unregistered by the previous handlers are skipped
+    for (auto& h: matched)
+	if (h->alive)
+	    h->fn(h->arg, ev.base, ev.id, ev.data.empty()? nullptr: const_cast<uint8_t*>(ev.data.data()));
+}; /* dispatch() */
+
+///@brief fetch the one posted event, waiting up to the deadline
+bool fetch(loop& l, posted& ev, clock::time_point until, bool forever)
+{
+	std::unique_lock<std::mutex> guard(l.lock);
+	auto ready = [&l]{ return l.stop || !l.queue.empty(); };
+
+    if (forever)
+	l.readable.wait(guard, ready);
+    else if (!ready() && (clock::now() >= until || !l.readable.wait_until(guard, until, ready)))
+	return false;
+    if (l.queue.empty())
+	return false;
+    ev = std::move(l.queue.front());
+    l.queue.pop_front();
+    l.writable.notify_all();
+    return true;
+}; /* fetch() */
+
+void loop_task(void* arg)
+{
+	loop& l = *static_cast<loop*>(arg);
+	posted ev;
+
+    while (fetch(l, ev, {}, true))
+	dispatch(l, ev);
+
+    {
+	std::lock_guard<std::mutex> guard(l.lock);
+	l.running = false;
+	l.stopped.notify_all();
+    }
+    vTaskDelete(nullptr);
+}; /* loop_task() */
+
+esp_err_t post(loop* l, esp_event_base_t base, int32_t id, const void* data, size_t size, TickType_t ticks)
+{
+    if (!l)
+	return ESP_ERR_INVALID_STATE;
+    if (!base || id == ESP_EVENT_ANY_ID)
+	return ESP_ERR_INVALID_ARG;
+
+	posted ev {base, id, {}};
+	std::unique_lock<std::mutex> guard(l->lock);
+	auto room = [l]{ return l->queue.size() < l->depth; };
+
+    if (ticks == portMAX_DELAY)
+	l->writable.wait(guard, room);
+    else if (!room() && (ticks == 0 || !l->writable.wait_until(guard, deadline(ticks), room)))
+	return ESP_ERR_TIMEOUT;
+    if (data && size)
+	ev.data.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+    l->queue.push_back(std::move(ev));
+    l->readable.notify_one();
+    return ESP_OK;
+}; /* post() */
+
+esp_err_t isr_post(loop* l, esp_event_base_t base, int32_t id, const void* data, size_t size, BaseType_t* woken)
+{
+    // the ISR posting carries the data of the int size at most, as on the target
+    if (size > sizeof(int))
+	return ESP_ERR_INVALID_ARG;
+    if (!l)
+	return ESP_ERR_INVALID_STATE;
+
+	std::lock_guard<std::mutex> guard(l->lock);
+
+    if (l->queue.size() >= l->depth)
+	return ESP_FAIL;
+    l->queue.push_back({base, id, {}});
+    if (data && size)
+	l->queue.back().data.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+    l->readable.notify_one();
+    if (woken)
+	*woken = pdTRUE;
+    return ESP_OK;
+}; /* isr_post() */
+
+esp_err_t enroll(loop* l, esp_event_base_t base, int32_t id, esp_event_handler_t fn, void* arg, bool legacy,
+	esp_event_handler_instance_t* instance)
+{
+    if (!l)
+	return ESP_ERR_INVALID_STATE;
+    if (!fn || (!base && id != ESP_EVENT_ANY_ID))
+	return ESP_ERR_INVALID_ARG;
+
+	std::lock_guard<std::recursive_mutex> guard(l->dispatching);
+
+    // the repeated legacy registration updates the argument only
+    if (legacy)
+	for (auto& h: l->handlers)
+	    if (h->legacy && h->fn == fn && h->base == base && h->id == id)
+	    {
+		h->arg = arg;
+		return ESP_OK;
+	    }
+    l->handlers.push_back(std::make_shared<handler>(handler {base, id, fn, arg, legacy}));
+    if (instance)
+	*instance = l->handlers.back().get();
+    return ESP_OK;
+}; /* enroll() */
+
+template <typename Pred>
+esp_err_t unreg(loop* l, Pred pred)
+{
+    if (!l)
+	return ESP_ERR_INVALID_STATE;
+
+	std::lock_guard<std::recursive_mutex> guard(l->dispatching);
+
+    for (auto it = l->handlers.begin(); it != l->handlers.end(); ++it)
+	if (pred(**it))
+	{
+	    (*it)->alive = false;
+	    l->handlers.erase(it);
+	    return ESP_OK;
+	}
+    return ESP_ERR_NOT_FOUND;
+}; /* unreg() */
+
+}; /* namespace */
+
+
+extern "C" esp_err_t esp_event_loop_create(const esp_event_loop_args_t* event_loop_args, esp_event_loop_handle_t* event_loop)
+{
+    if (!event_loop_args || !event_loop || event_loop_args->queue_size <= 0)
+	return ESP_ERR_INVALID_ARG;
+
+	loop* l = new loop(event_loop_args->queue_size);
+
+    if (event_loop_args->task_name)
+    {
+	l->running = true;
+	xTaskCreatePinnedToCore(loop_task, event_loop_args->task_name, event_loop_args->task_stack_size, l,
+		event_loop_args->task_priority, &l->task, event_loop_args->task_core_id);
+    }
+    *event_loop = l;
+    return ESP_OK;
+}; /* esp_event_loop_create() */
+
+extern "C" esp_err_t esp_event_loop_delete(esp_event_loop_handle_t event_loop)
+{
+    if (!event_loop)
+	return ESP_ERR_INVALID_ARG;
+
+	loop* l = static_cast<loop*>(event_loop);
+
+    {
+	std::unique_lock<std::mutex> guard(l->lock);
+
+	l->stop = true;
+	l->readable.notify_all();
+	if (l->task != xTaskGetCurrentTaskHandle())
+	    l->stopped.wait(guard, [l]{ return !l->running; });
+    }
+    delete l;
+    return ESP_OK;
+}; /* esp_event_loop_delete() */
+
+extern "C" esp_err_t esp_event_loop_create_default(void)
+{
+    if (default_loop)
+	return ESP_ERR_INVALID_STATE;
+
+	esp_event_loop_args_t args = {32, "sys_evt", 20, 2304, 0};
+	esp_event_loop_handle_t handle;
+	esp_err_t err = esp_event_loop_create(&args, &handle);
+
+    if (err == ESP_OK)
+	default_loop = static_cast<loop*>(handle);
+    return err;
+}; /* esp_event_loop_create_default() */
+
+extern "C" esp_err_t esp_event_loop_delete_default(void)
+{
+    if (!default_loop)
+	return ESP_ERR_INVALID_STATE;
+
+	esp_err_t err = esp_event_loop_delete(default_loop);
+
+    default_loop = nullptr;
+    return err;
+}; /* esp_event_loop_delete_default() */
+
+///@brief dispatch the events of the loop w/o the task for up to 'ticks_to_run' ticks
+extern "C" esp_err_t esp_event_loop_run(esp_event_loop_handle_t event_loop, TickType_t ticks_to_run)
+{
+    if (!event_loop)
+	return ESP_ERR_INVALID_ARG;
+
+	loop& l = *static_cast<loop*>(event_loop);
+	bool forever = ticks_to_run == portMAX_DELAY;
+	auto until = deadline(forever? 0: ticks_to_run);
+	posted ev;
+
+    while (fetch(l, ev, until, forever))
+	dispatch(l, ev);
+    return ESP_OK;
+}; /* esp_event_loop_run() */
+
+
+extern "C" esp_err_t esp_event_handler_register(esp_event_base_t event_base, int32_t event_id,
+	esp_event_handler_t event_handler, void* event_handler_arg)
+{
+    return enroll(default_loop, event_base, event_id, event_handler, event_handler_arg, true, nullptr);
+}; /* esp_event_handler_register() */
+
+extern "C" esp_err_t esp_event_handler_register_with(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
+	int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg)
+{
+    return enroll(static_cast<loop*>(event_loop), event_base, event_id, event_handler, event_handler_arg, true, nullptr);
+}; /* esp_event_handler_register_with() */
+
+extern "C" esp_err_t esp_event_handler_unregister(esp_event_base_t event_base, int32_t event_id,
+	esp_event_handler_t event_handler)
+{
+    return esp_event_handler_unregister_with(default_loop, event_base, event_id, event_handler);
+}; /* esp_event_handler_unregister() */
+
+extern "C" esp_err_t esp_event_handler_unregister_with(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
+	int32_t event_id, esp_event_handler_t event_handler)
+{
+    return unreg(static_cast<loop*>(event_loop), [=](const handler& h) {
+	return h.legacy && h.fn == event_handler && h.base == event_base && h.id == event_id;
+    });
+}; /* esp_event_handler_unregister_with() */
+
+extern "C" esp_err_t esp_event_handler_instance_register(esp_event_base_t event_base, int32_t event_id,
+	esp_event_handler_t event_handler, void* event_handler_arg, esp_event_handler_instance_t* instance)
+{
+    return enroll(default_loop, event_base, event_id, event_handler, event_handler_arg, false, instance);
+}; /* esp_event_handler_instance_register() */
+
+extern "C" esp_err_t esp_event_handler_instance_register_with(esp_event_loop_handle_t event_loop,
+	esp_event_base_t event_base, int32_t event_id, esp_event_handler_t event_handler, void* event_handler_arg,
+	esp_event_handler_instance_t* instance)
+{
+    return enroll(static_cast<loop*>(event_loop), event_base, event_id, event_handler, event_handler_arg, false, instance);
+}; /* esp_event_handler_instance_register_with() */
+
+extern "C" esp_err_t esp_event_handler_instance_unregister(esp_event_base_t event_base, int32_t event_id,
+	esp_event_handler_instance_t instance)
+{
+    return esp_event_handler_instance_unregister_with(default_loop, event_base, event_id, instance);
+}; /* esp_event_handler_instance_unregister() */
+
+extern "C" esp_err_t esp_event_handler_instance_unregister_with(esp_event_loop_handle_t event_loop,
+	esp_event_base_t event_base, int32_t event_id, esp_event_handler_instance_t instance)
+{
+    if (!instance)
+	return ESP_ERR_INVALID_ARG;
+    return unreg(static_cast<loop*>(event_loop), [=](const handler& h) {
+	return !h.legacy && &h == instance && h.base == event_base && h.id == event_id;
+    });
+}; /* esp_event_handler_instance_unregister_with() */
+
+
+extern "C" esp_err_t esp_event_post(esp_event_base_t event_base, int32_t event_id, const void* event_data,
+	size_t event_data_size, TickType_t ticks_to_wait)
+{
+    return post(default_loop, event_base, event_id, event_data, event_data_size, ticks_to_wait);
+}; /* esp_event_post() */
+
+extern "C" esp_err_t esp_event_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t event_base, int32_t event_id,
+	const void* event_data, size_t event_data_size, TickType_t ticks_to_wait)
+{
+    return post(static_cast<loop*>(event_loop), event_base, event_id, event_data, event_data_size, ticks_to_wait);
+}; /* esp_event_post_to() */
+
+extern "C" esp_err_t esp_event_isr_post(esp_event_base_t event_base, int32_t event_id, const void* event_data,
+	size_t event_data_size, BaseType_t* task_unblocked)
+{
+    return isr_post(default_loop, event_base, event_id, event_data, event_data_size, task_unblocked);
+}; /* esp_event_isr_post() */
+
+extern "C" esp_err_t esp_event_isr_post_to(esp_event_loop_handle_t event_loop, esp_event_base_t event_base,
+	int32_t event_id, const void* event_data, size_t event_data_size, BaseType_t* task_unblocked)
+{
+    return isr_post(static_cast<loop*>(event_loop), event_base, event_id, event_data, event_data_size, task_unblocked);
+}; /* esp_event_isr_post_to() */
@@ -0,0 +1,70 @@
+/*!@file esp_log.cpp
+ *
+ * @brief Host stand-in of the ESP-IDF logging & the error names
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <esp_err.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#include <atomic>
+#include <cstdio>
+
+
+namespace
+{
+
+std::atomic<vprintf_like_t> writer {&std::vprintf};
+std::atomic<esp_log_level_t> threshold {ESP_LOG_INFO};
+
+}; /* namespace */
+
+
+///@brief the per-tag levels are not kept: the level of the any tag is the global one
+extern "C" void esp_log_level_set(const char* /*tag*/, esp_log_level_t level)
+{
+    threshold = level;
+}; /* esp_log_level_set() */
+
+extern "C" vprintf_like_t esp_log_set_vprintf(vprintf_like_t func)
+{
+    return writer.exchange(func);
+}; /* esp_log_set_vprintf() */
+
+extern "C" void esp_log_write(esp_log_level_t level, const char* /*tag*/, const char* format, ...)
+{
+    if (level > threshold.load(std::memory_order_relaxed))
+	return;
+
+	va_list args;
+
+    va_start(args, format);
+    writer.load()(format, args);
+    va_end(args);
+}; /* esp_log_write() */
+
+extern "C" uint32_t esp_log_timestamp(void)
+{
+    return uint32_t(esp_timer_get_time() / 1000);
+}; /* esp_log_timestamp() */
+
+
+extern "C" const char* esp_err_to_name(esp_err_t code)
+{
+    switch (code)
+    {
+    case ESP_OK:		return "ESP_OK";
+    case ESP_FAIL:		return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:	return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:	return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:	return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:	return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:	return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:	return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:	return "ESP_ERR_TIMEOUT";
+    default:			return "UNKNOWN ERROR";
+    }
+}; /* esp_err_to_name() */
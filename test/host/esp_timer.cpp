@@ -0,0 +1,158 @@
+/*!@file esp_timer.cpp
+ *
+ * @brief Host stand-in of the ESP-IDF high resolution timer: the callbacks are dispatched by the one
+ *	  timer thread, the timer lock is held while the callback runs, as the esp_timer task does
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <esp_timer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+struct esp_timer
+{
+    esp_timer_cb_t callback;
+    void* arg;
+    int64_t due = 0;			///< the time of the next shot, us
+    uint64_t period = 0;		///< 0 for the one-shot timer
+    bool active = false;
+}; /* struct esp_timer */
+
+
+namespace
+{
+
+using clock = std::chrono::steady_clock;
+
+const clock::time_point boot = clock::now();
+
+// the state of the timer thread is never freed: the detached thread still waits on it at the process exit
+std::recursive_mutex& lock = *new std::recursive_mutex;
+std::condition_variable_any& changed = *new std::condition_variable_any;
+std::vector<esp_timer*>& timers = *new std::vector<esp_timer*>;
+
+///@brief the timer task: fire the due timers in the order of the due time
+[[noreturn]] void dispatch()
+{
+	std::unique_lock<std::recursive_mutex> guard(lock);
+
+    for (;;)
+    {
+	esp_timer* next = nullptr;
+
+	for (auto t: timers)
+	    if (t->active && (!next || t->due < next->due))
+		next = t;
+	if (!next)
+	{
+	    changed.wait(guard);
+	    continue;
+	}
+
+	int64_t now = esp_timer_get_time();
+
+	if (next->due > now)
+	{
+	    changed.wait_until(guard, boot + std::chrono::microseconds(next->due));
+	    continue;
+	}
+	if (next->period)
+	    next->due = std::max<int64_t>(next->due + next->period, now);
+	else
+	    next->active = false;
+	next->callback(next->arg);
+    }
+}; /* dispatch() */
+
+void start_dispatcher()
+{
+	static std::once_flag started;
+    std::call_once(started, []{ std::thread(dispatch).detach(); });
+}; /* start_dispatcher() */
+
+esp_err_t start(esp_timer_handle_t timer, uint64_t timeout, uint64_t period)
+{
+	std::lock_guard<std::recursive_mutex> guard(lock);
+
+    if (!timer)
+	return ESP_ERR_INVALID_ARG;
+    if (timer->active)
+	return ESP_ERR_INVALID_STATE;
+    timer->due = esp_timer_get_time() + int64_t(timeout);
+    timer->period = period;
+    timer->active = true;
+    changed.notify_all();
+    return ESP_OK;
+}; /* start() */
+
+}; /* namespace */
+
+
+extern "C" int64_t esp_timer_get_time(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - boot).count();
+}; /* esp_timer_get_time() */
+
+extern "C" esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle)
+{
+    if (!create_args || !create_args->callback || !out_handle)
+	return ESP_ERR_INVALID_ARG;
+
+    start_dispatcher();
+
+	std::lock_guard<std::recursive_mutex> guard(lock);
+
+    *out_handle = new esp_timer {create_args->callback, create_args->arg};
+    timers.push_back(*out_handle);
+    return ESP_OK;
+}; /* esp_timer_create() */
+
+extern "C" esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    return start(timer, timeout_us, 0);
+}; /* esp_timer_start_once() */
+
+extern "C" esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    return start(timer, period, period);
+}; /* esp_timer_start_periodic() */
+
+extern "C" esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+	std::lock_guard<std::recursive_mutex> guard(lock);
+
+    if (!timer)
+	return ESP_ERR_INVALID_ARG;
+    if (!timer->active)
+	return ESP_ERR_INVALID_STATE;
+    timer->active = false;
+    changed.notify_all();
+    return ESP_OK;
+}; /* esp_timer_stop() */
+
+extern "C" esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+	std::lock_guard<std::recursive_mutex> guard(lock);
+
+    if (!timer)
+	return ESP_ERR_INVALID_ARG;
+    if (timer->active)
+	return ESP_ERR_INVALID_STATE;
+    timers.erase(std::find(timers.begin(), timers.end(), timer));
+    delete timer;
+    return ESP_OK;
+}; /* esp_timer_delete() */
+
+extern "C" bool esp_timer_is_active(esp_timer_handle_t timer)
+{
+	std::lock_guard<std::recursive_mutex> guard(lock);
+    return timer && timer->active;
+}; /* esp_timer_is_active() */
@@ -0,0 +1,765 @@
+/*!@file freertos.cpp
+ *
+ * @brief Host stand-in of the FreeRTOS kernel: the tasks are the POSIX threads, all the kernel objects
+ *	  are serialized by the one kernel mutex, each object wakes its waiters by own condition variable
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/event_groups.h>
+
+#include <sched.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "host.hpp"
+
+
+namespace
+{
+
+using clock = std::chrono::steady_clock;
+
+const clock::time_point boot = clock::now();
+constexpr auto tick_period = std::chrono::nanoseconds(1000000000 / configTICK_RATE_HZ);
+
+std::mutex kernel;			///< the one lock of all the kernel objects
+std::condition_variable gone;		///< signaled when the deleted task has parked
+
+thread_local bool in_isr = false;
+
+}; /* namespace */
+
+
+struct tskTaskControlBlock
+{
+    std::string name;
+    UBaseType_t prio;
+    BaseType_t core;
+
+    std::condition_variable notified;	///< waiting for the direct-to-task notification
+    uint32_t value = 0;			///< notification value
+
+    std::condition_variable* blocked_on = nullptr;	///< the object this task is waiting for
+    bool deleted = false;		///< deletion was requested by the other task
+    bool parked = false;		///< the task will never run again
+
+    tskTaskControlBlock(const char* n, UBaseType_t p, BaseType_t c): name(n? n: ""), prio(p), core(c) {};
+}; /* struct tskTaskControlBlock */
+
+
+namespace
+{
+
+// the TCBs are never freed: the handles may be used after the task is deleted, as dangling handles on the target
+thread_local TaskHandle_t self = nullptr;
+
+///@brief the TCB of the calling thread; the main & the foreign threads are adopted lazily
+TaskHandle_t current()
+{
+    if (!self)
+	self = new tskTaskControlBlock("main", 1, tskNO_AFFINITY);
+    return self;
+}; /* current() */
+
+TickType_t ticks_now()
+{
+    return TickType_t((clock::now() - boot) / tick_period);
+}; /* ticks_now() */
+
+///@brief the time point of the tick the wait of the 'ticks' ticks from now ends at
+clock::time_point deadline(TickType_t ticks)
+{
+    return boot + tick_period * (uint64_t(ticks_now()) + ticks);
+}; /* deadline() */
+
+///@brief the deleted task stops here forever: its frames may reference the objects deleted after it
+[[noreturn]] void park(std::unique_lock<std::mutex>& lock)
+{
+    current()->parked = true;
+    gone.notify_all();
+    lock.unlock();
+    for (;;)
+	std::this_thread::sleep_for(std::chrono::hours(1));
+}; /* park() */
+
+///@brief wait under the kernel lock for the ready() condition up to 'ticks' ticks
+template <typename Ready>
+bool block(std::unique_lock<std::mutex>& lock, std::condition_variable& cv, TickType_t ticks, Ready ready)
+{
+	TaskHandle_t me = current();
+
+    if (me->deleted)
+	park(lock);
+    if (ready())
+	return true;
+    if (ticks == 0)
+	return false;
+
+    configASSERT(!in_isr);
+    me->blocked_on = &cv;
+    auto wake = [&]{ return me->deleted || ready(); };
+    bool ok = (ticks == portMAX_DELAY)? (cv.wait(lock, wake), true): cv.wait_until(lock, deadline(ticks), wake);
+    me->blocked_on = nullptr;
+    if (me->deleted)
+	park(lock);
+    return ok;
+}; /* block() */
+
+thread_local uint32_t mux_token = 0;
+std::atomic<uint32_t> mux_tokens {0};
+
+}; /* namespace */
+
+
+namespace host
+{
+
+isr_scope::isr_scope()
+{
+    in_isr = true;
+}; /* isr_scope::isr_scope() */
+
+isr_scope::~isr_scope()
+{
+    in_isr = false;
+}; /* isr_scope::~isr_scope() */
+
+}; /* namespace host */
+
+
+//--[ port ]-----------------------------------------------------------------------------------------------------------
+
+extern "C" void vAssertCalled(const char* expr, const char* file, int line)
+{
+    std::fprintf(stderr, "assert failed: %s %s:%d\n", expr, file, line);
+    std::fflush(stderr);
+    std::abort();
+}; /* vAssertCalled() */
+
+extern "C" void spinlock_initialize(portMUX_TYPE* mux)
+{
+    mux->owner = portMUX_FREE_VAL;
+    mux->count = 0;
+}; /* spinlock_initialize() */
+
+extern "C" void vPortEnterCritical(portMUX_TYPE* mux)
+{
+    if (!mux_token)
+	mux_token = ++mux_tokens;
+
+    if (__atomic_load_n(&mux->owner, __ATOMIC_RELAXED) == mux_token)
+    {
+	mux->count = mux->count + 1;
+	return;
+    }
+    for (uint32_t expected = portMUX_FREE_VAL;
+	 !__atomic_compare_exchange_n(&mux->owner, &expected, mux_token, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+	 expected = portMUX_FREE_VAL)
+	sched_yield();
+    mux->count = 1;
+}; /* vPortEnterCritical() */
+
+extern "C" void vPortExitCritical(portMUX_TYPE* mux)
+{
+    configASSERT(mux->owner == mux_token && mux->count > 0);
+    mux->count = mux->count - 1;
+    if (mux->count == 0)
+	__atomic_store_n(&mux->owner, portMUX_FREE_VAL, __ATOMIC_RELEASE);
+}; /* vPortExitCritical() */
+
+extern "C" BaseType_t xPortInIsrContext(void)
+{
+    return in_isr? pdTRUE: pdFALSE;
+}; /* xPortInIsrContext() */
+
+extern "C" void vPortYield(void)
+{
+    sched_yield();
+}; /* vPortYield() */
+
+extern "C" void vPortYieldFromISR(void)
+{
+}; /* vPortYieldFromISR() */
+
+
+//--[ tasks ]----------------------------------------------------------------------------------------------------------
+
+extern "C" BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char* pcName, uint32_t /*usStackDepth*/,
+	void* pvParameters, UBaseType_t uxPriority, TaskHandle_t* pvCreatedTask, BaseType_t xCoreID)
+{
+	TaskHandle_t tcb = new tskTaskControlBlock(pcName, uxPriority, xCoreID);
+
+    if (pvCreatedTask)
+	*pvCreatedTask = tcb;
+    std::thread([tcb, pvTaskCode, pvParameters] {
+	self = tcb;
+	pvTaskCode(pvParameters);
+	vAssertCalled("task function returned", __FILE__, __LINE__);
+    }).detach();
+    return pdPASS;
+}; /* xTaskCreatePinnedToCore() */
+
+extern "C" BaseType_t xTaskCreate(TaskFunction_t pvTaskCode, const char* pcName, uint32_t usStackDepth, void* pvParameters,
+	UBaseType_t uxPriority, TaskHandle_t* pvCreatedTask)
+{
+    return xTaskCreatePinnedToCore(pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pvCreatedTask, tskNO_AFFINITY);
+}; /* xTaskCreate() */
+
+///@brief delete the task: the other task is waited for until it parks at the kernel call
+extern "C" void vTaskDelete(TaskHandle_t xTaskToDelete)
+{
+	std::unique_lock<std::mutex> lock(kernel);
+	TaskHandle_t tcb = xTaskToDelete? xTaskToDelete: current();
+
+    if (tcb == current())
+	park(lock);
+
+    tcb->deleted = true;
+    if (tcb->blocked_on)
+	tcb->blocked_on->notify_all();
+    gone.wait(lock, [tcb]{ return tcb->parked; });
+}; /* vTaskDelete() */
+
+extern "C" void vTaskDelay(TickType_t xTicksToDelay)
+{
+	std::unique_lock<std::mutex> lock(kernel);
+	TickType_t until = ticks_now() + xTicksToDelay;
+
+    block(lock, current()->notified, xTicksToDelay, [until]{ return TickType_t(ticks_now() - until) < 0x80000000u; });
+}; /* vTaskDelay() */
+
+extern "C" TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return current();
+}; /* xTaskGetCurrentTaskHandle() */
+
+extern "C" const char* pcTaskGetName(TaskHandle_t xTaskToQuery)
+{
+    return (xTaskToQuery? xTaskToQuery: current())->name.c_str();
+}; /* pcTaskGetName() */
+
+extern "C" UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+    return (xTask? xTask: current())->prio;
+}; /* uxTaskPriorityGet() */
+
+extern "C" void vTaskPrioritySet(TaskHandle_t xTask, UBaseType_t uxNewPriority)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+    (xTask? xTask: current())->prio = uxNewPriority;
+}; /* vTaskPrioritySet() */
+
+extern "C" BaseType_t xTaskGetCoreID(TaskHandle_t xTask)
+{
+    return (xTask? xTask: current())->core;
+}; /* xTaskGetCoreID() */
+
+extern "C" BaseType_t xPortGetCoreID(void)
+{
+	BaseType_t core = current()->core;
+    return (core == tskNO_AFFINITY)? 0: core;
+}; /* xPortGetCoreID() */
+
+extern "C" TickType_t xTaskGetTickCount(void)
+{
+    return ticks_now();
+}; /* xTaskGetTickCount() */
+
+extern "C" TickType_t xTaskGetTickCountFromISR(void)
+{
+    return ticks_now();
+}; /* xTaskGetTickCountFromISR() */
+
+// the threads are preempted by the host anyway: the scheduler suspension is a hint only
+extern "C" void vTaskSuspendAll(void)
+{
+}; /* vTaskSuspendAll() */
+
+extern "C" BaseType_t xTaskResumeAll(void)
+{
+    return pdFALSE;
+}; /* xTaskResumeAll() */
+
+extern "C" void vTaskSetTimeOutState(TimeOut_t* pxTimeOut)
+{
+    pxTimeOut->xOverflowCount = 0;
+    pxTimeOut->xTimeOnEntering = ticks_now();
+}; /* vTaskSetTimeOutState() */
+
+extern "C" BaseType_t xTaskCheckForTimeOut(TimeOut_t* pxTimeOut, TickType_t* pxTicksToWait)
+{
+    if (*pxTicksToWait == portMAX_DELAY)
+	return pdFALSE;
+
+	TickType_t elapsed = ticks_now() - pxTimeOut->xTimeOnEntering;
+
+    if (elapsed < *pxTicksToWait)
+    {
+	*pxTicksToWait -= elapsed;
+	vTaskSetTimeOutState(pxTimeOut);
+	return pdFALSE;
+    }
+    *pxTicksToWait = 0;
+    return pdTRUE;
+}; /* xTaskCheckForTimeOut() */
+
+
+//--[ notifications ]--------------------------------------------------------------------------------------------------
+
+extern "C" BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+
+    xTaskToNotify->value++;
+    xTaskToNotify->notified.notify_all();
+    return pdPASS;
+}; /* xTaskNotifyGive() */
+
+extern "C" void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+
+    xTaskToNotify->value++;
+    if (xTaskToNotify->blocked_on == &xTaskToNotify->notified && pxHigherPriorityTaskWoken)
+	*pxHigherPriorityTaskWoken = pdTRUE;
+    xTaskToNotify->notified.notify_all();
+}; /* vTaskNotifyGiveFromISR() */
+
+extern "C" uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait)
+{
+	std::unique_lock<std::mutex> lock(kernel);
+	TaskHandle_t me = current();
+
+    block(lock, me->notified, xTicksToWait, [me]{ return me->value != 0; });
+
+	uint32_t value = me->value;
+
+    if (value)
+	me->value = xClearCountOnExit? 0: value - 1;
+    return value;
+}; /* ulTaskNotifyTake() */
+
+extern "C" uint32_t ulTaskNotifyValueClear(TaskHandle_t xTask, uint32_t ulBitsToClear)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+	TaskHandle_t tcb = xTask? xTask: current();
+	uint32_t value = tcb->value;
+
+    tcb->value &= ~ulBitsToClear;
+    return value;
+}; /* ulTaskNotifyValueClear() */
+
+
+//--[ queues & semaphores ]--------------------------------------------------------------------------------------------
+
+struct QueueDefinition
+{
+    enum kind_t {queue, semaphore, mutex, recursive};
+
+    const kind_t kind;
+    const UBaseType_t length;		///< capacity of the queue, max count of the semaphore
+    const UBaseType_t size;		///< item size, 0 for the semaphores
+    std::vector<uint8_t> storage;
+    UBaseType_t head = 0;
+    UBaseType_t count = 0;		///< items in the queue, count of the semaphore
+
+    TaskHandle_t holder = nullptr;	///< mutex holder
+    UBaseType_t recursion = 0;
+
+    std::condition_variable readable;	///< waiting for the items or the count
+    std::condition_variable writable;	///< waiting for the free space
+
+    QueueDefinition(kind_t k, UBaseType_t len, UBaseType_t sz, UBaseType_t initial = 0):
+	kind(k), length(len), size(sz), storage(size_t(len) * sz), count(initial) {};
+
+    bool full() const { return count >= length; };
+
+    void push(const void* item, bool front)
+    {
+	if (size && item)
+	{
+	    if (front)
+		head = (head + length - 1) % length;
+	    std::memcpy(&storage[size_t(front? head: (head + count) % length) * size], item, size);
+	}
+	count++;
+	readable.notify_all();
+    }; /* push() */
+
+    void pop(void* item, bool peek = false)
+    {
+	if (size && item)
+	    std::memcpy(item, &storage[size_t(head) * size], size);
+	if (peek)
+	    return;
+	if (size)
+	    head = (head + 1) % length;
+	count--;
+	writable.notify_all();
+    }; /* pop() */
+}; /* struct QueueDefinition */
+
+
+namespace
+{
+
+BaseType_t queue_send(QueueHandle_t q, const void* item, TickType_t ticks, bool front)
+{
+	std::unique_lock<std::mutex> lock(kernel);
+
+    if (!block(lock, q->writable, ticks, [q]{ return !q->full(); }))
+	return pdFAIL;
+    q->push(item, front);
+    return pdPASS;
+}; /* queue_send() */
+
+BaseType_t queue_send_from_isr(QueueHandle_t q, const void* item, BaseType_t* woken)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+
+    if (q->full())
+	return pdFAIL;
+    q->push(item, false);
+    if (woken)
+	*woken = pdTRUE;
+    return pdPASS;
+}; /* queue_send_from_isr() */
+
+BaseType_t queue_receive(QueueHandle_t q, void* item, TickType_t ticks, bool peek)
+{
+	std::unique_lock<std::mutex> lock(kernel);
+
+    if (!block(lock, q->readable, ticks, [q]{ return q->count > 0; }))
+	return pdFAIL;
+    q->pop(item, peek);
+    return pdPASS;
+}; /* queue_receive() */
+
+}; /* namespace */
+
+
+extern "C" QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize)
+{
+    configASSERT(uxQueueLength > 0);
+    return new QueueDefinition(QueueDefinition::queue, uxQueueLength, uxItemSize);
+}; /* xQueueCreate() */
+
+extern "C" QueueHandle_t xQueueCreateStatic(UBaseType_t uxQueueLength, UBaseType_t uxItemSize, uint8_t*, StaticQueue_t*)
+{
+    return xQueueCreate(uxQueueLength, uxItemSize);
+}; /* xQueueCreateStatic() */
+
+extern "C" void vQueueDelete(QueueHandle_t xQueue)
+{
+    delete xQueue;
+}; /* vQueueDelete() */
+
+extern "C" BaseType_t xQueueSend(QueueHandle_t xQueue, const void* pvItemToQueue, TickType_t xTicksToWait)
+{
+    return queue_send(xQueue, pvItemToQueue, xTicksToWait, false);
+}; /* xQueueSend() */
+
+extern "C" BaseType_t xQueueSendToBack(QueueHandle_t xQueue, const void* pvItemToQueue, TickType_t xTicksToWait)
+{
+    return queue_send(xQueue, pvItemToQueue, xTicksToWait, false);
+}; /* xQueueSendToBack() */
+
+extern "C" BaseType_t xQueueSendToFront(QueueHandle_t xQueue, const void* pvItemToQueue, TickType_t xTicksToWait)
+{
+    return queue_send(xQueue, pvItemToQueue, xTicksToWait, true);
+}; /* xQueueSendToFront() */
+
+extern "C" BaseType_t xQueueReceive(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait)
+{
+    return queue_receive(xQueue, pvBuffer, xTicksToWait, false);
+}; /* xQueueReceive() */
+
+extern "C" BaseType_t xQueuePeek(QueueHandle_t xQueue, void* pvBuffer, TickType_t xTicksToWait)
+{
+    return queue_receive(xQueue, pvBuffer, xTicksToWait, true);
+}; /* xQueuePeek() */
+
+extern "C" BaseType_t xQueueSendFromISR(QueueHandle_t xQueue, const void* pvItemToQueue, BaseType_t* pxHigherPriorityTaskWoken)
+{
+    return queue_send_from_isr(xQueue, pvItemToQueue, pxHigherPriorityTaskWoken);
+}; /* xQueueSendFromISR() */
+
+extern "C" BaseType_t xQueueReceiveFromISR(QueueHandle_t xQueue, void* pvBuffer, BaseType_t* pxHigherPriorityTaskWoken)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+
+    if (xQueue->count == 0)
+	return pdFAIL;
+    xQueue->pop(pvBuffer);
+    if (pxHigherPriorityTaskWoken)
+	*pxHigherPriorityTaskWoken = pdTRUE;
+    return pdPASS;
+}; /* xQueueReceiveFromISR() */
+
+extern "C" UBaseType_t uxQueueMessagesWaiting(QueueHandle_t xQueue)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+    return xQueue->count;
+}; /* uxQueueMessagesWaiting() */
+
+extern "C" UBaseType_t uxQueueSpacesAvailable(QueueHandle_t xQueue)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+    return xQueue->length - xQueue->count;
+}; /* uxQueueSpacesAvailable() */
+
+extern "C" BaseType_t xQueueReset(QueueHandle_t xQueue)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+
+    xQueue->head = xQueue->count = 0;
+    xQueue->writable.notify_all();
+    return pdPASS;
+}; /* xQueueReset() */
+
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return new QueueDefinition(QueueDefinition::semaphore, 1, 0);
+}; /* xSemaphoreCreateBinary() */
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t*)
+{
+    return xSemaphoreCreateBinary();
+}; /* xSemaphoreCreateBinaryStatic() */
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t uxMaxCount, UBaseType_t uxInitialCount)
+{
+    configASSERT(uxMaxCount > 0 && uxInitialCount <= uxMaxCount);
+    return new QueueDefinition(QueueDefinition::semaphore, uxMaxCount, 0, uxInitialCount);
+}; /* xSemaphoreCreateCounting() */
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateCountingStatic(UBaseType_t uxMaxCount, UBaseType_t uxInitialCount,
+	StaticSemaphore_t*)
+{
+    return xSemaphoreCreateCounting(uxMaxCount, uxInitialCount);
+}; /* xSemaphoreCreateCountingStatic() */
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return new QueueDefinition(QueueDefinition::mutex, 1, 0, 1);
+}; /* xSemaphoreCreateMutex() */
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t*)
+{
+    return xSemaphoreCreateMutex();
+}; /* xSemaphoreCreateMutexStatic() */
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return new QueueDefinition(QueueDefinition::recursive, 1, 0, 1);
+}; /* xSemaphoreCreateRecursiveMutex() */
+
+extern "C" SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t*)
+{
+    return xSemaphoreCreateRecursiveMutex();
+}; /* xSemaphoreCreateRecursiveMutexStatic() */
+
+extern "C" void vSemaphoreDelete(SemaphoreHandle_t xSemaphore)
+{
+    delete xSemaphore;
+}; /* vSemaphoreDelete() */
+
+extern "C" BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime)
+{
+	std::unique_lock<std::mutex> lock(kernel);
+
+    if (!block(lock, xSemaphore->readable, xBlockTime, [xSemaphore]{ return xSemaphore->count > 0; }))
+	return pdFAIL;
+    xSemaphore->pop(nullptr);
+    if (xSemaphore->kind != QueueDefinition::semaphore)
+	xSemaphore->holder = current();
+    return pdPASS;
+}; /* xSemaphoreTake() */
+
+extern "C" BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+
+    if (xSemaphore->kind != QueueDefinition::semaphore)
+    {
+	if (xSemaphore->holder != current())
+	    return pdFAIL;
+	xSemaphore->holder = nullptr;
+    }
+    if (xSemaphore->full())
+	return pdFAIL;
+    xSemaphore->push(nullptr, false);
+    return pdPASS;
+}; /* xSemaphoreGive() */
+
+extern "C" BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t xMutex, TickType_t xBlockTime)
+{
+    {
+	std::lock_guard<std::mutex> lock(kernel);
+
+	configASSERT(xMutex->kind == QueueDefinition::recursive);
+	if (xMutex->holder == current())
+	{
+	    xMutex->recursion++;
+	    return pdPASS;
+	}
+    }
+    if (xSemaphoreTake(xMutex, xBlockTime) != pdPASS)
+	return pdFAIL;
+
+	std::lock_guard<std::mutex> lock(kernel);
+    xMutex->recursion = 1;
+    return pdPASS;
+}; /* xSemaphoreTakeRecursive() */
+
+extern "C" BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t xMutex)
+{
+    {
+	std::lock_guard<std::mutex> lock(kernel);
+
+	configASSERT(xMutex->kind == QueueDefinition::recursive);
+	if (xMutex->holder != current())
+	    return pdFAIL;
+	if (--xMutex->recursion > 0)
+	    return pdPASS;
+    }
+    return xSemaphoreGive(xMutex);
+}; /* xSemaphoreGiveRecursive() */
+
+extern "C" BaseType_t xSemaphoreTakeFromISR(SemaphoreHandle_t xSemaphore, BaseType_t* pxHigherPriorityTaskWoken)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+
+    configASSERT(xSemaphore->kind == QueueDefinition::semaphore);
+    if (xSemaphore->count == 0)
+	return pdFAIL;
+    xSemaphore->pop(nullptr);
+    if (pxHigherPriorityTaskWoken)
+	*pxHigherPriorityTaskWoken = pdTRUE;
+    return pdPASS;
+}; /* xSemaphoreTakeFromISR() */
+
+extern "C" BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t xSemaphore, BaseType_t* pxHigherPriorityTaskWoken)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+
+    configASSERT(xSemaphore->kind == QueueDefinition::semaphore);
+    if (xSemaphore->full())
+	return pdFAIL;
+    xSemaphore->push(nullptr, false);
+    if (pxHigherPriorityTaskWoken)
+	*pxHigherPriorityTaskWoken = pdTRUE;
+    return pdPASS;
+}; /* xSemaphoreGiveFromISR() */
+
+extern "C" UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t xSemaphore)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+    return xSemaphore->count;
+}; /* uxSemaphoreGetCount() */
+
+extern "C" TaskHandle_t xSemaphoreGetMutexHolder(SemaphoreHandle_t xSemaphore)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+    return xSemaphore->holder;
+}; /* xSemaphoreGetMutexHolder() */
+
+
+//--[ event groups ]---------------------------------------------------------------------------------------------------
+
+struct EventGroupDef_t
+{
+    EventBits_t bits = 0;
+    std::condition_variable changed;
+}; /* struct EventGroupDef_t */
+
+// the upper byte is reserved by the kernel on the target
+static constexpr EventBits_t reserved_bits = 0xff000000u;
+
+extern "C" EventGroupHandle_t xEventGroupCreate(void)
+{
+    return new EventGroupDef_t;
+}; /* xEventGroupCreate() */
+
+extern "C" EventGroupHandle_t xEventGroupCreateStatic(StaticEventGroup_t*)
+{
+    return xEventGroupCreate();
+}; /* xEventGroupCreateStatic() */
+
+extern "C" void vEventGroupDelete(EventGroupHandle_t xEventGroup)
+{
+    delete xEventGroup;
+}; /* vEventGroupDelete() */
+
+extern "C" EventBits_t xEventGroupWaitBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToWaitFor,
+	BaseType_t xClearOnExit, BaseType_t xWaitForAllBits, TickType_t xTicksToWait)
+{
+    configASSERT((uxBitsToWaitFor & reserved_bits) == 0 && uxBitsToWaitFor != 0);
+
+	std::unique_lock<std::mutex> lock(kernel);
+	EventGroupHandle_t grp = xEventGroup;
+	auto done = [=]{
+	    return xWaitForAllBits? (grp->bits & uxBitsToWaitFor) == uxBitsToWaitFor: (grp->bits & uxBitsToWaitFor) != 0;
+	};
+
+	bool ok = block(lock, grp->changed, xTicksToWait, done);
+	EventBits_t bits = grp->bits;
+
+    if (ok && xClearOnExit)
+	grp->bits &= ~uxBitsToWaitFor;
+    return bits;
+}; /* xEventGroupWaitBits() */
+
+extern "C" EventBits_t xEventGroupSetBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToSet)
+{
+    configASSERT((uxBitsToSet & reserved_bits) == 0);
+
+	std::lock_guard<std::mutex> lock(kernel);
+
+    xEventGroup->bits |= uxBitsToSet;
+    xEventGroup->changed.notify_all();
+    return xEventGroup->bits;
+}; /* xEventGroupSetBits() */
+
+extern "C" EventBits_t xEventGroupClearBits(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToClear)
+{
+    configASSERT((uxBitsToClear & reserved_bits) == 0);
+
+	std::lock_guard<std::mutex> lock(kernel);
+	EventBits_t bits = xEventGroup->bits;
+
+    xEventGroup->bits &= ~uxBitsToClear;
+    return bits;
+}; /* xEventGroupClearBits() */
+
+extern "C" EventBits_t xEventGroupGetBits(EventGroupHandle_t xEventGroup)
+{
+	std::lock_guard<std::mutex> lock(kernel);
+    return xEventGroup->bits;
+}; /* xEventGroupGetBits() */
+
+extern "C" BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t xEventGroup, EventBits_t uxBitsToSet,
+	BaseType_t* pxHigherPriorityTaskWoken)
+{
+    xEventGroupSetBits(xEventGroup, uxBitsToSet);
+    if (pxHigherPriorityTaskWoken)
+	*pxHigherPriorityTaskWoken = pdTRUE;
+    return pdPASS;
+}; /* xEventGroupSetBitsFromISR() */
@@ -0,0 +1,92 @@
+/*!@file FreeRTOS.h
+ *
+ * @brief Host stand-in of the ESP-IDF FreeRTOS: base types, tick rate, critical sections & ISR context;
+ *	  the tasks are the POSIX threads, the kernel objects are built on the one kernel mutex
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sdkconfig.h"
+#include "esp_idf_version.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdFALSE			((BaseType_t)0)
+#define pdTRUE			((BaseType_t)1)
+#define pdFAIL			(pdFALSE)
+#define pdPASS			(pdTRUE)
+
+#define portMAX_DELAY		((TickType_t)0xffffffffUL)
+
+#define configTICK_RATE_HZ	CONFIG_FREERTOS_HZ
+#define portTICK_PERIOD_MS	((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)	((TickType_t)(((uint64_t)(ms) * (uint64_t)configTICK_RATE_HZ) / 1000U))
+#define pdTICKS_TO_MS(ticks)	((TickType_t)(((uint64_t)(ticks) * 1000U) / (uint64_t)configTICK_RATE_HZ))
+
+#define configNUMBER_OF_CORES	CONFIG_FREERTOS_NUMBER_OF_CORES
+#define portNUM_PROCESSORS	configNUMBER_OF_CORES
+#define configMAX_PRIORITIES	25
+
+#define tskNO_AFFINITY		((BaseType_t)0x7fffffff)
+
+///@brief failed assertion of the kernel: print the place & abort
+void vAssertCalled(const char* expr, const char* file, int line);
+#define configASSERT(x) ((x)? (void)0: vAssertCalled(#x, __FILE__, __LINE__))
+
+
+///@brief spinlock of the critical section; recursive for the owner thread, as on the target
+typedef struct {
+    volatile uint32_t owner;
+    volatile uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_FREE_VAL		0
+#define portMUX_INITIALIZER_UNLOCKED	{portMUX_FREE_VAL, 0}
+
+void vPortEnterCritical(portMUX_TYPE* mux);
+void vPortExitCritical(portMUX_TYPE* mux);
+void spinlock_initialize(portMUX_TYPE* mux);
+
+#define portMUX_INITIALIZE(mux)		spinlock_initialize(mux)
+#define portENTER_CRITICAL(mux)		vPortEnterCritical(mux)
+#define portEXIT_CRITICAL(mux)		vPortExitCritical(mux)
+#define portENTER_CRITICAL_ISR(mux)	vPortEnterCritical(mux)
+#define portEXIT_CRITICAL_ISR(mux)	vPortExitCritical(mux)
+#define portENTER_CRITICAL_SAFE(mux)	vPortEnterCritical(mux)
+#define portEXIT_CRITICAL_SAFE(mux)	vPortExitCritical(mux)
+#define taskENTER_CRITICAL(mux)		vPortEnterCritical(mux)
+#define taskEXIT_CRITICAL(mux)		vPortExitCritical(mux)
+#define taskENTER_CRITICAL_ISR(mux)	vPortEnterCritical(mux)
+#define taskEXIT_CRITICAL_ISR(mux)	vPortExitCritical(mux)
+
+///@brief is the current thread in the "ISR" context? see host::isr_scope
+BaseType_t xPortInIsrContext(void);
+
+void vPortYield(void);
+void vPortYieldFromISR(void);
+#define portYIELD()		vPortYield()
+#define portYIELD_FROM_ISR(...)	vPortYieldFromISR()
+#define taskYIELD()		vPortYield()
+
+///@brief storage of the static kernel objects: the host objects are allocated in the heap, the buffers are not used
+typedef struct { void* dummy[12]; } StaticSemaphore_t;
+typedef struct { void* dummy[12]; } StaticQueue_t;
+typedef struct { void* dummy[8]; } StaticEventGroup_t;
+typedef struct { void* dummy[32]; } StaticTask_t;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,62 @@
+/*!@file task.h
+ *
+ * @brief Host stand-in of the FreeRTOS tasks API: the tasks are the POSIX threads; ticks, timeouts
+ *	  & the direct-to-task notifications
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#pragma once
+
+#include "FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define tskKERNEL_VERSION_MAJOR	10
+#define tskKERNEL_VERSION_MINOR	5
+#define tskKERNEL_VERSION_BUILD	1
+
+#define tskIDLE_PRIORITY	((UBaseType_t)0U)
+
+typedef struct tskTaskControlBlock* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct {
+    BaseType_t xOverflowCount;
+    TickType_t xTimeOnEntering;
+} TimeOut_t;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char* pcName, uint32_t usStackDepth, void* pvParameters,
+	UBaseType_t uxPriority, TaskHandle_t* pvCreatedTask, BaseType_t xCoreID);
+BaseType_t xTaskCreate(TaskFunction_t pvTaskCode, const char* pcName, uint32_t usStackDepth, void* pvParameters,
+	UBaseType_t uxPriority, TaskHandle_t* pvCreatedTask);
+void vTaskDelete(TaskHandle_t xTaskToDelete);
+void vTaskDelay(TickType_t xTicksToDelay);
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+const char* pcTaskGetName(TaskHandle_t xTaskToQuery);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t xTask);
+void vTaskPrioritySet(TaskHandle_t xTask, UBaseType_t uxNewPriority);
+BaseType_t xPortGetCoreID(void);
+BaseType_t xTaskGetCoreID(TaskHandle_t xTask);
+
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+
+void vTaskSuspendAll(void);
+BaseType_t xTaskResumeAll(void);
+
+void vTaskSetTimeOutState(TimeOut_t* pxTimeOut);
+BaseType_t xTaskCheckForTimeOut(TimeOut_t* pxTimeOut, TickType_t* pxTicksToWait);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify);
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t* pxHigherPriorityTaskWoken);
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+uint32_t ulTaskNotifyValueClear(TaskHandle_t xTask, uint32_t ulBitsToClear);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,25 @@
+/*!@file host.hpp
+ *
+ * @brief Host-only helpers of the FreeRTOS stand-in, for the tests: simulated ISR context
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#pragma once
+
+namespace host
+{
+
+///@brief the calling thread is treated as the ISR for the lifetime of this object:
+/// xPortInIsrContext() returns pdTRUE, the "FromISR" API are called from here
+struct isr_scope
+{
+    isr_scope();
+    ~isr_scope();
+
+    isr_scope(const isr_scope&) = delete;
+    isr_scope& operator =(const isr_scope&) = delete;
+}; /* struct isr_scope */
+
+}; /* namespace host */
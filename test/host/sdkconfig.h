@@ -0,0 +1,30 @@
+/*!@file sdkconfig.h
+ *
+ * @brief Host stand-in of the generated sdkconfig.h: the Kconfig options of the component for the host tests;
+ *	  the options may be overridden by the compile definitions of the test targets
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#pragma once
+
+#ifndef CONFIG_FREERTOS_HZ
+#define CONFIG_FREERTOS_HZ 100
+#endif
+
+#ifndef CONFIG_FREERTOS_NUMBER_OF_CORES
+#define CONFIG_FREERTOS_NUMBER_OF_CORES 2
+#endif
+
+#ifndef CONFIG_ASO_UTILS_TRACE_RING_SIZE
+#define CONFIG_ASO_UTILS_TRACE_RING_SIZE 64
+#endif
+
+#ifndef CONFIG_ASO_UTILS_ADAPTIVE_SPIN
+#define CONFIG_ASO_UTILS_ADAPTIVE_SPIN 200
+#endif
+
+#ifndef CONFIG_ESP_EVENT_POST_FROM_ISR
+#define CONFIG_ESP_EVENT_POST_FROM_ISR 1
+#endif
@@ -0,0 +1,277 @@
+/*!@file test_amutex.cpp
+ *
+ * @brief Tests of the amutex family: mutex, recursive mutex & the readers-writer lock
+ *	  with the std::lock_guard/std::shared_lock
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "asemaphore"
+#include "amutex"
+
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+///@brief run the body in the other task & wait for it
+template <typename Body>
+void in_other_task(Body&& body)
+{
+    std::thread(std::forward<Body>(body)).join();
+}; /* in_other_task() */
+
+}; /* namespace */
+
+
+//--[ amutex & arecursive_mutex ]--------------------------------------------------------------------------------------
+
+template <typename Mutex>
+class mutex: public ::testing::Test {};
+
+using mutex_types = ::testing::Types<amutex, amutex::stat>;
+TYPED_TEST_SUITE(mutex, mutex_types);
+
+TYPED_TEST(mutex, exclusive_with_the_holder)
+{
+	TypeParam mtx;
+
+    ASSERT_TRUE(mtx.created());
+    EXPECT_EQ(mtx.holder(), nullptr);
+    {
+	    std::lock_guard lock(mtx);
+
+	EXPECT_EQ(mtx.holder(), xTaskGetCurrentTaskHandle());
+	in_other_task([&] { EXPECT_FALSE(mtx.try_lock()); });
+    }
+    EXPECT_EQ(mtx.holder(), nullptr);
+    in_other_task([&] {
+	EXPECT_TRUE(mtx.try_lock());
+	mtx.unlock();
+    });
+}
+
+TYPED_TEST(mutex, give_by_the_non_holder_fails)
+{
+	TypeParam mtx;
+
+    mtx.lock();
+    in_other_task([&] { EXPECT_NE(mtx.Give(), pdTRUE); });
+    EXPECT_EQ(mtx.Give(), pdTRUE);
+}
+
+TYPED_TEST(mutex, counter_is_consistent)
+{
+	TypeParam mtx;
+	long counter = 0;
+	std::vector<std::thread> tasks;
+
+    for (int t = 0; t < 4; t++)
+	tasks.emplace_back([&] {
+	    for (int i = 0; i < 10000; i++)
+	    {
+		    std::lock_guard lock(mtx);
+
+		counter = counter + 1;
+	    }
+	});
+    for (std::thread& t: tasks)
+	t.join();
+    EXPECT_EQ(counter, 40000);
+}
+
+TEST(recursive_mutex, taken_repeatedly_by_the_holder)
+{
+	arecursive_mutex mtx;
+	arecursive_mutex::stat smtx;
+
+    for (amutex_base* m: {static_cast<amutex_base*>(&mtx), static_cast<amutex_base*>(&smtx)})
+    {
+	EXPECT_EQ(m->Take(0), pdTRUE);
+	EXPECT_EQ(m->Take(0), pdTRUE);
+	EXPECT_EQ(m->Give(), pdTRUE);
+	in_other_task([&] { EXPECT_FALSE(m->try_lock()); });
+	EXPECT_EQ(m->Give(), pdTRUE);
+	in_other_task([&] {
+	    EXPECT_TRUE(m->try_lock());
+	    m->unlock();
+	});
+    }
+}
+
+
+//--[ arwlock ]--------------------------------------------------------------------------------------------------------
+
+template <typename Lock>
+class rwlock: public ::testing::Test {};
+
+using rwlock_types = ::testing::Types<arwlock, arwlock::stat>;
+TYPED_TEST_SUITE(rwlock, rwlock_types);
+
+TYPED_TEST(rwlock, readers_share_writer_excludes)
+{
+	TypeParam rw;
+
+    {
+	    std::shared_lock r1(rw);
+	    std::shared_lock r2(rw);
+
+	EXPECT_FALSE(rw.try_lock());
+	EXPECT_TRUE(rw.try_lock_shared());
+	rw.unlock_shared();
+    }
+    {
+	    std::lock_guard w(rw);
+
+	EXPECT_FALSE(rw.try_lock_shared());
+	EXPECT_FALSE(rw.try_lock());
+    }
+    EXPECT_TRUE(rw.try_lock());
+    rw.unlock();
+}
+
+///@brief the waiting writer stops the new readers & gets the lock after the active readers
+TYPED_TEST(rwlock, writer_preference)
+{
+	TypeParam rw;
+	std::atomic<bool> written {false};
+
+    rw.lock_shared();
+	std::thread writer([&] {
+	    std::lock_guard w(rw);
+
+	    written = true;
+	});
+    // the writer is waiting for the reader
+    std::this_thread::sleep_for(30ms);
+    EXPECT_FALSE(written);
+    in_other_task([&] { EXPECT_FALSE(rw.try_lock_shared()); });
+
+	std::thread reader([&] {
+	    std::shared_lock r(rw);
+
+	    EXPECT_TRUE(written);
+	});
+
+    std::this_thread::sleep_for(30ms);
+    rw.unlock_shared();
+    writer.join();
+    reader.join();
+    EXPECT_TRUE(written);
+}
+
+///@brief the data, written under the lock, is never seen torn by the readers
+TYPED_TEST(rwlock, readers_see_consistent_data)
+{
+	TypeParam rw;
+	long a = 0, b = 0;
+	std::atomic<bool> stop {false};
+	std::atomic<long> torn {0}, reads {0};
+	std::vector<std::thread> readers;
+
+    for (int t = 0; t < 3; t++)
+	readers.emplace_back([&] {
+	    while (!stop)
+	    {
+		    std::shared_lock r(rw);
+
+		if (a != b)
+		    torn++;
+		reads++;
+	    }
+	});
+    for (int i = 0; i < 2000; i++)
+    {
+	    std::lock_guard w(rw);
+
+	a = i;
+	std::this_thread::yield();
+	b = i;
+    }
+    stop = true;
+    for (std::thread& t: readers)
+	t.join();
+    EXPECT_EQ(torn, 0);
+    EXPECT_GT(reads, 0);
+}
+
+
+//--[ amutex::adaptive ]-----------------------------------------------------------------------------------------------
+
+TEST(adaptive, try_lock_is_the_single_attempt)
+{
+	amutex::adaptive lock(1000000);
+
+    EXPECT_TRUE(lock.try_lock());
+    in_other_task([&] {
+	    auto start = std::chrono::steady_clock::now();
+
+	EXPECT_FALSE(lock.try_lock());
+	// w/o the million of the spin iterations
+	EXPECT_LT(std::chrono::steady_clock::now() - start, 1ms);
+    });
+    EXPECT_EQ(lock.spins(), 0u);
+    EXPECT_EQ(lock.parks(), 0u);
+    lock.unlock();
+    EXPECT_TRUE(lock.try_lock());
+    lock.unlock();
+}
+
+TEST(adaptive, take_times_out)
+{
+	amutex::adaptive lock(10);
+
+    lock.lock();
+    in_other_task([&] {
+	EXPECT_EQ(lock.Take(0), pdFAIL);
+	EXPECT_EQ(lock.Take(pdMS_TO_TICKS(30)), pdFAIL);
+    });
+    EXPECT_GE(lock.parks(), 1u);
+    lock.unlock();
+}
+
+TEST(adaptive, counter_is_consistent)
+{
+    for (unsigned spin: {0u, 200u})
+    {
+	    amutex::adaptive lock(spin);
+	    long counter = 0;
+	    std::vector<std::thread> tasks;
+
+	for (int t = 0; t < 4; t++)
+	    tasks.emplace_back([&] {
+		for (int i = 0; i < 10000; i++)
+		{
+			std::lock_guard guard(lock);
+
+		    counter = counter + 1;
+		    if (i % 100 == 0)
+			std::this_thread::yield();
+		}
+	    });
+	for (std::thread& t: tasks)
+	    t.join();
+	EXPECT_EQ(counter, 40000) << "spin " << spin;
+	if (spin == 0)
+	{
+	    EXPECT_EQ(lock.spins(), 0u);
+	}
+	lock.reset_counters();
+	EXPECT_EQ(lock.spins() + lock.parks(), 0u);
+    }
+}
@@ -0,0 +1,85 @@
+/*!@file test_argview.cpp
+ *
+ * @brief Tests of the arguments views & of the allocator-aware makestor/mk_containerholder:
+ *	  the command line is kept w/o the heap, in the caller buffer or in the arena
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <freertos/FreeRTOS.h>
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "argview.hpp"
+#include "astring.h"
+#include "pool.hpp"
+
+
+namespace
+{
+
+char arg0[] = "set", arg1[] = "wifi.ssid", arg2[] = "a rather long value, longer than the small string buffer";
+char* argv[] = {arg0, arg1, arg2};
+constexpr int argc = std::size(argv);
+
+}; /* namespace */
+
+
+TEST(argview, into_the_buffer)
+{
+	std::string_view buf[8];
+	std::span<std::string_view> args = astr::argview(argc, argv, buf);
+
+    ASSERT_EQ(args.size(), 3u);
+    EXPECT_EQ(args.data(), buf);
+    EXPECT_EQ(args[1], "wifi.ssid");
+    // views, not copies
+    EXPECT_EQ(args[2].data(), arg2);
+}
+
+TEST(argview, truncated_by_the_buffer)
+{
+	std::string_view buf[2];
+
+    EXPECT_EQ(astr::argview(argc, argv, buf).size(), 2u);
+    EXPECT_EQ(astr::argview(0, argv, buf).size(), 0u);
+}
+
+TEST(argview, into_the_arena)
+{
+	aso::arena<256> arena(std::pmr::null_memory_resource());
+	std::span<std::string_view> args = astr::argview(argc, argv, &arena);
+
+    ASSERT_EQ(args.size(), 3u);
+    EXPECT_EQ(args[0], "set");
+    EXPECT_EQ(args[2].data(), arg2);
+}
+
+///@brief the whole command line in the arena: the null upstream throws on any allocation out of the arena
+TEST(argview, makestor_and_holder_in_the_arena)
+{
+	aso::arena<1024> arena(std::pmr::null_memory_resource());
+
+	auto vec = astr::makestor<std::pmr::vector<std::pmr::string>>(argc, argv, &arena);
+	auto lst = astr::mk_containerholder<std::pmr::list, std::pmr::basic_string>(argc, argv, &arena);
+
+    ASSERT_EQ(vec.size(), 3u);
+    ASSERT_EQ(lst.size(), 3u);
+    EXPECT_EQ(vec[2], arg2);
+    EXPECT_EQ(lst.back(), arg2);
+    EXPECT_EQ(lst.front().get_allocator().resource(), &arena);
+}
+
+TEST(argview, heap_holders_are_unchanged)
+{
+	auto vec = astr::mk_containerholder<std::vector, std::basic_string>(argc, argv);
+	auto lst = astr::mk_containerholder<std::list, std::basic_string>(argc, argv);
+
+    EXPECT_EQ(vec, (std::vector<std::string>{arg0, arg1, arg2}));
+    EXPECT_EQ(lst.front(), arg0);
+}
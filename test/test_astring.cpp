@@ -0,0 +1,266 @@
+/*!@file test_astring.cpp
+ *
+ * @brief Tests of the astr string utils
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "astring.h"
+
+
+//--[ answer words ]---------------------------------------------------------------------------------------------------
+
+TEST(answer, builtin_keywords_case_insensitive)
+{
+    for (const char* word: {"y", "Y", "yes", "YeS", "on", "ON", "ok", "Ok"})
+    {
+	EXPECT_EQ(astr::answer_of(word), astr::answer::yes) << word;
+	EXPECT_TRUE(astr::confirm(word)) << word;
+	EXPECT_FALSE(astr::decline(word)) << word;
+    }
+    for (const char* word: {"n", "N", "no", "nO", "cancel", "CANCEL"})
+    {
+	EXPECT_EQ(astr::answer_of(word), astr::answer::no) << word;
+	EXPECT_TRUE(astr::decline(word)) << word;
+	EXPECT_FALSE(astr::confirm(word)) << word;
+    }
+}
+
+TEST(answer, numeric_values)
+{
+    for (const char* num: {"1", "42", "1_000", " 7 ", "007"})
+	EXPECT_TRUE(astr::confirm(num)) << num;
+    for (const char* num: {"0", "000", "0_0", " 0 "})
+	EXPECT_TRUE(astr::decline(num)) << num;
+}
+
+TEST(answer, empty_and_spaces_are_negation)
+{
+    EXPECT_TRUE(astr::decline(""));
+    EXPECT_TRUE(astr::decline(" \t "));
+    EXPECT_FALSE(astr::confirm(""));
+}
+
+TEST(answer, not_an_answer)
+{
+    for (const char* word: {"maybe", "yess", "ye", "y es", "nope", "onn", "0x1", "-1", "1.5"})
+    {
+	EXPECT_EQ(astr::answer_of(word), astr::answer::none) << word;
+	EXPECT_FALSE(astr::confirm(word)) << word;
+	EXPECT_FALSE(astr::decline(word)) << word;
+    }
+}
+
+TEST(answer, user_words)
+{
+    EXPECT_FALSE(astr::confirm("da"));
+    ASSERT_TRUE(astr::enroll_answer("da", astr::answer::yes));
+    ASSERT_TRUE(astr::enroll_answer("net", astr::answer::no));
+    EXPECT_TRUE(astr::confirm("Da"));
+    EXPECT_TRUE(astr::decline("NET"));
+    // the built-in keywords are not shadowed
+    EXPECT_TRUE(astr::confirm("yes"));
+
+    EXPECT_FALSE(astr::enroll_answer("Upper", astr::answer::yes));
+    EXPECT_FALSE(astr::enroll_answer("word", astr::answer::none));
+    EXPECT_FALSE(astr::enroll_answer("", astr::answer::no));
+}
+
+TEST(answer, pure_c_api)
+{
+    EXPECT_TRUE(yes_str("Yes"));
+    EXPECT_FALSE(yes_str("no"));
+    EXPECT_TRUE(no_str("cancel"));
+    EXPECT_FALSE(no_str("ok"));
+}
+
+
+//--[ values parsing ]-------------------------------------------------------------------------------------------------
+
+TEST(parse, integers)
+{
+    EXPECT_EQ(astr::parse<int>(" 42 "), 42);
+    EXPECT_EQ(astr::parse<int>("-1_000"), -1000);
+    EXPECT_EQ(astr::parse<unsigned>("0xFf"), 255u);
+    EXPECT_EQ(astr::parse<uint8_t>("0b1010_0101"), 0xa5);
+    EXPECT_EQ(astr::parse<int8_t>("-128"), -128);
+    EXPECT_EQ(astr::parse<int8_t>("128"), std::nullopt);
+    EXPECT_EQ(astr::parse<unsigned>("-1"), std::nullopt);
+    EXPECT_EQ(astr::parse<long long>("9223372036854775807"), std::numeric_limits<long long>::max());
+    EXPECT_EQ(astr::parse<long long>("-9223372036854775808"), std::numeric_limits<long long>::min());
+    EXPECT_EQ(astr::parse<unsigned long long>("18446744073709551616"), std::nullopt);
+    for (const char* bad: {"", " ", "_1", "1_", "1__0", "0x", "12a", "0b2", "+-1", "1 2"})
+	EXPECT_EQ(astr::parse<int>(bad), std::nullopt) << bad;
+}
+
+TEST(parse, booleans)
+{
+    EXPECT_EQ(astr::parse<bool>(" yes "), true);
+    EXPECT_EQ(astr::parse<bool>("No"), false);
+    EXPECT_EQ(astr::parse<bool>("maybe"), std::nullopt);
+    EXPECT_EQ(astr::parse<bool>(""), std::nullopt);
+}
+
+TEST(parse, floats)
+{
+    EXPECT_EQ(astr::parse<double>("1.5"), 1.5);
+    EXPECT_EQ(astr::parse<double>(" -0.25 "), -0.25);
+    EXPECT_EQ(astr::parse<double>("+2"), 2.0);
+    EXPECT_EQ(astr::parse<double>(".5"), 0.5);
+    EXPECT_EQ(astr::parse<double>("5."), 5.0);
+    EXPECT_EQ(astr::parse<double>("1_000.000_5"), 1000.0005);
+    EXPECT_EQ(astr::parse<double>("1e3"), 1000.0);
+    EXPECT_EQ(astr::parse<double>("2.5E-2"), 0.025);
+    EXPECT_EQ(astr::parse<double>("1e+2"), 100.0);
+    EXPECT_EQ(astr::parse<float>("0.1"), 0.1f);
+    EXPECT_EQ(astr::parse<long double>("0.1"), 0.1L);
+    EXPECT_EQ(astr::parse<double>("1e300"), 1e300);
+}
+
+TEST(parse, floats_out_of_range)
+{
+    EXPECT_EQ(astr::parse<double>("1e400"), std::nullopt);
+    EXPECT_EQ(astr::parse<double>("-1e400"), std::nullopt);
+    EXPECT_EQ(astr::parse<double>("1e-400"), std::nullopt);
+    EXPECT_EQ(astr::parse<float>("1e300"), std::nullopt);
+    EXPECT_EQ(astr::parse<float>("-1e39"), std::nullopt);
+    EXPECT_EQ(astr::parse<float>("1e-50"), std::nullopt);
+    EXPECT_EQ(astr::parse<float>("3.4e38"), 3.4e38f);
+}
+
+TEST(parse, floats_rejected_forms)
+{
+    for (const char* bad: {"", " ", "inf", "-inf", "infinity", "nan", "NaN", "nan(1)", "0x1p3", "0X1.8P1", "1e_5", "1e5_0",
+			   "_1.5", "1.5_", "1_.5", "1._5", "1__0", ".", "-", "+", "e5", ".e5", "1e", "1e+", "1.5.3", "1e5e2",
+			   "+-1", "--1", "1,5", "1 5", "1.5f", "0b101"})
+	EXPECT_EQ(astr::parse<double>(bad), std::nullopt) << bad;
+}
+
+
+//--[ trim & tokenizing ]----------------------------------------------------------------------------------------------
+
+TEST(trim, string_in_place)
+{
+	std::string str = " \t key = value \r\n";
+	const char* data = str.data();
+
+    EXPECT_EQ(&astr::trim(str), &str);
+    EXPECT_EQ(str, "key = value");
+    EXPECT_EQ(str.data(), data);	// w/o reallocation
+
+    for (auto [in, out]: std::initializer_list<std::pair<const char*, const char*>> {
+	    {"", ""}, {"   ", ""}, {"\t\n", ""}, {"a", "a"}, {" a", "a"}, {"a ", "a"}, {"a b", "a b"}})
+    {
+	    std::string s = in;
+
+	EXPECT_EQ(astr::trim(s), out) << '"' << in << '"';
+    }
+}
+
+TEST(split, key_and_value)
+{
+    EXPECT_EQ(astr::split(" key = value "), std::make_pair(std::string_view("key"), std::string_view("value")));
+    // the first delimiter only
+    EXPECT_EQ(astr::split("a=b=c"), std::make_pair(std::string_view("a"), std::string_view("b=c")));
+    EXPECT_EQ(astr::split("name: x", ':'), std::make_pair(std::string_view("name"), std::string_view("x")));
+}
+
+TEST(split, empty_and_missing_parts)
+{
+	using parts = std::pair<std::string_view, std::string_view>;
+
+    EXPECT_EQ(astr::split(""), parts());
+    EXPECT_EQ(astr::split("   "), parts());
+    EXPECT_EQ(astr::split(" key "), parts("key", ""));
+    EXPECT_EQ(astr::split("=value"), parts("", "value"));
+    EXPECT_EQ(astr::split("key="), parts("key", ""));
+    EXPECT_EQ(astr::split(" = "), parts());
+}
+
+TEST(next_token, cuts_the_tokens)
+{
+	std::string_view rest = "  one two\tthree\n";
+
+    EXPECT_EQ(astr::next_token(rest), "one");
+    EXPECT_EQ(astr::next_token(rest), "two");
+    EXPECT_EQ(astr::next_token(rest), "three");
+    EXPECT_EQ(astr::next_token(rest), "");
+    EXPECT_TRUE(rest.empty());
+    EXPECT_EQ(astr::next_token(rest), "");
+}
+
+TEST(next_token, repeated_leading_and_trailing_delimiters)
+{
+	std::string_view rest = ",,a,, b ,,,c,,";
+
+    EXPECT_EQ(astr::next_token(rest, ","), "a");
+    EXPECT_EQ(astr::next_token(rest, ","), "b");
+    EXPECT_EQ(astr::next_token(rest, ","), "c");
+    EXPECT_EQ(astr::next_token(rest, ","), "");
+    EXPECT_TRUE(rest.empty());
+
+    // the empty input & the delimiters only: no tokens
+    for (std::string_view none: {"", ",", ",,,", " , , "})
+	EXPECT_EQ(astr::next_token(none, ","), "") << '"' << none << '"';
+
+    // the space only token between the delimiters is skipped
+    rest = "x;  ;y";
+    EXPECT_EQ(astr::next_token(rest, ";"), "x");
+    EXPECT_EQ(astr::next_token(rest, ";"), "y");
+}
+
+TEST(tokens, range_for)
+{
+	std::vector<std::string_view> got;
+
+    for (std::string_view line: astr::tokens("\nfirst line\n\n  second  \n\n", "\n"))
+	got.push_back(line);
+    EXPECT_EQ(got, (std::vector<std::string_view> {"first line", "second"}));
+
+    got.clear();
+    for (std::string_view word: astr::tokens(" a  bb\tccc "))
+	got.push_back(word);
+    EXPECT_EQ(got, (std::vector<std::string_view> {"a", "bb", "ccc"}));
+}
+
+TEST(tokens, iterator_end_conditions)
+{
+    // no tokens: begin is the end
+    for (std::string_view none: {"", "   ", ",,", " , "})
+    {
+	    astr::tokens t(none, ", ");
+
+	EXPECT_TRUE(t.begin() == t.end()) << '"' << none << '"';
+	EXPECT_FALSE(t.begin() != t.end());
+    }
+
+	astr::tokens t("a,b", ",");
+	auto it = t.begin();
+
+    ASSERT_NE(it, t.end());
+    EXPECT_EQ(*it, "a");
+    EXPECT_EQ(it->size(), 1u);
+
+    // the post increment returns the previous token
+    auto prev = it++;
+    EXPECT_EQ(*prev, "a");
+    EXPECT_EQ(*it, "b");
+    ++it;
+    EXPECT_EQ(it, t.end());
+    // the end iterator stays at the end
+    ++it;
+    EXPECT_EQ(it, t.end());
+    EXPECT_EQ(astr::tokens::iterator(), astr::tokens::iterator());
+
+    EXPECT_EQ(std::distance(astr::tokens("1 2 3 4").begin(), astr::tokens("1 2 3 4").end()), 4);
+}
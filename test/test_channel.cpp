@@ -0,0 +1,228 @@
+/*!@file test_channel.cpp
+ *
+ * @brief Tests of the event::channel zero-copy payload channel on the local event loop: the slots pooling & reuse,
+ *	  the retain/release by the fan out handlers, the exhausted pool, the failed post, the reclaim of the slots
+ *	  of the never dispatched events
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+
+#include <memory>
+
+#include "event_ctrl.hpp"
+#include "event_channel.hpp"
+#include "event_registry.hpp"
+
+
+ESP_EVENT_DEFINE_BASE(CHANNEL_TEST_EVENT);
+
+namespace
+{
+
+///@brief the payload counts it's live instances
+struct sample
+{
+    explicit sample(int v): value(v) { live++; };
+    ~sample() { live--; };
+
+    int value;
+    static inline int live = 0;
+}; /* struct sample */
+
+using test_channel = event::channel<sample, 2, 3>;
+
+///@brief the typed subscriber: stores the last value, retains the payload on request
+struct receiver: test_channel::typed
+{
+    explicit receiver(test_channel* keep = nullptr): keeper(keep) {};
+
+    void receive(const sample& payload) override {
+	calls++;
+	last = payload.value;
+	if (keeper)
+	{
+	    keeper->retain(payload);
+	    kept = &payload;
+	}; };
+
+    test_channel* keeper;
+    const sample* kept = nullptr;
+    int calls = 0;
+    int last = 0;
+}; /* struct receiver */
+
+///@brief the plain handler subscriber: gets the pointer to the payload as the event data
+struct plain: event::handler::base
+{
+    plain(): base(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID) {};
+    void instance_handler(void*, esp_event_base_t, int32_t, void* data) override {
+	last = static_cast<const sample*>(data)->value; };
+
+    int last = 0;
+}; /* struct plain */
+
+///@brief the event loop w/o the task with the registered channel: dispatched by the test itself
+class channel_loop: public ::testing::Test
+{
+protected:
+    void SetUp() override {
+	    esp_event_loop_args_t args = {2, nullptr, 0, 0, 0};
+
+	sample::live = 0;
+	ASSERT_EQ(esp_event_loop_create(&args, &loop), ESP_OK);
+	chan = std::make_unique<test_channel>(CHANNEL_TEST_EVENT, 1, loop);
+	reg = registrar.enroll_to(loop, *chan);
+	ASSERT_TRUE(reg); };
+    void TearDown() override {
+	reg.unreg();
+	if (loop)
+	    esp_event_loop_delete(loop);
+	chan.reset();
+	EXPECT_EQ(sample::live, 0); };
+
+    void run() { esp_event_loop_run(loop, 0); };
+
+    esp_event_loop_handle_t loop = nullptr;
+    std::unique_ptr<test_channel> chan;
+    event::registry<2> registrar;
+    event::registry<2>::token reg;
+}; /* class channel_loop */
+
+}; /* namespace */
+
+
+TEST_F(channel_loop, fan_out_to_the_subscribers)
+{
+	receiver r;
+	plain p;
+
+    ASSERT_TRUE(chan->subscribe(r));
+    ASSERT_TRUE(chan->subscribe(p));
+    ASSERT_EQ(chan->post(0, 42), ESP_OK);
+    EXPECT_EQ(sample::live, 1);
+    run();
+    EXPECT_EQ(r.calls, 1);
+    EXPECT_EQ(r.last, 42);
+    EXPECT_EQ(p.last, 42);
+    EXPECT_EQ(sample::live, 0);
+    EXPECT_EQ(chan->available(), 2u);
+}; /* fan_out_to_the_subscribers */
+
+TEST_F(channel_loop, subscribers_table_is_bounded)
+{
+	receiver r[4];
+
+    for (int i = 0; i < 3; i++)
+	EXPECT_TRUE(chan->subscribe(r[i]));
+    EXPECT_FALSE(chan->subscribe(r[3]));
+    chan->unsubscribe(r[1]);
+    EXPECT_TRUE(chan->subscribe(r[3]));
+    ASSERT_EQ(chan->post(0, 5), ESP_OK);
+    run();
+    EXPECT_EQ(r[0].calls + r[1].calls + r[2].calls + r[3].calls, 3);
+    EXPECT_EQ(r[1].calls, 0);
+}; /* subscribers_table_is_bounded */
+
+TEST_F(channel_loop, slots_are_pooled_and_reused)
+{
+	receiver r;
+
+    chan->subscribe(r);
+    for (int round = 0; round < 10; round++)
+    {
+	ASSERT_EQ(chan->post(0, 2 * round), ESP_OK);
+	ASSERT_EQ(chan->post(0, 2 * round + 1), ESP_OK);
+	EXPECT_EQ(chan->available(), 0u);
+	// the pool is exhausted
+	EXPECT_EQ(chan->post(0, -1), ESP_ERR_NO_MEM);
+	EXPECT_EQ(sample::live, 2);
+	run();
+	EXPECT_EQ(chan->available(), 2u);
+	EXPECT_EQ(r.last, 2 * round + 1);
+    }
+    EXPECT_EQ(r.calls, 20);
+}; /* slots_are_pooled_and_reused */
+
+TEST_F(channel_loop, retained_payload_outlives_the_dispatch)
+{
+	receiver keeping(chan.get()), other;
+
+    chan->subscribe(keeping);
+    chan->subscribe(other);
+    ASSERT_EQ(chan->post(0, 7), ESP_OK);
+    run();
+    EXPECT_EQ(other.calls, 1);
+    ASSERT_NE(keeping.kept, nullptr);
+    EXPECT_EQ(keeping.kept->value, 7);
+    EXPECT_EQ(sample::live, 1);
+    EXPECT_EQ(chan->available(), 1u);
+
+    chan->release(*keeping.kept);
+    EXPECT_EQ(sample::live, 0);
+    EXPECT_EQ(chan->available(), 2u);
+}; /* retained_payload_outlives_the_dispatch */
+
+TEST_F(channel_loop, failed_post_releases_the_slot)
+{
+    // the loop queue of the 2 events is filled by the foreign events
+    ASSERT_EQ(esp_event_post_to(loop, CHANNEL_TEST_EVENT, 2, nullptr, 0, 0), ESP_OK);
+    ASSERT_EQ(esp_event_post_to(loop, CHANNEL_TEST_EVENT, 2, nullptr, 0, 0), ESP_OK);
+    EXPECT_NE(chan->post(0, 1), ESP_OK);
+    EXPECT_EQ(sample::live, 0);
+    EXPECT_EQ(chan->available(), 2u);
+    EXPECT_EQ(chan->reclaim(), 0u);
+    run();
+}; /* failed_post_releases_the_slot */
+
+TEST_F(channel_loop, reclaim_after_unregister)
+{
+	receiver r;
+
+    chan->subscribe(r);
+    ASSERT_EQ(chan->post(0, 1), ESP_OK);
+    ASSERT_EQ(chan->post(0, 2), ESP_OK);
+    // the channel is unregistered before the events are dispatched: the slots are not returned by itself
+    reg.unreg();
+    run();
+    EXPECT_EQ(r.calls, 0);
+    EXPECT_EQ(chan->available(), 0u);
+    EXPECT_EQ(chan->reclaim(), 2u);
+    EXPECT_EQ(chan->available(), 2u);
+    EXPECT_EQ(sample::live, 0);
+    EXPECT_EQ(chan->reclaim(), 0u);
+}; /* reclaim_after_unregister */
+
+TEST_F(channel_loop, reclaim_after_the_loop_delete_keeps_the_retained)
+{
+	receiver keeping(chan.get());
+
+    chan->subscribe(keeping);
+    ASSERT_EQ(chan->post(0, 1), ESP_OK);
+    run();
+    ASSERT_EQ(chan->post(0, 2), ESP_OK);
+    reg.unreg();
+    esp_event_loop_delete(loop);
+    loop = nullptr;
+
+    // the dispatched & retained payload is not reclaimed
+    EXPECT_EQ(chan->reclaim(), 1u);
+    EXPECT_EQ(sample::live, 1);
+    EXPECT_EQ(chan->available(), 1u);
+    chan->release(*keeping.kept);
+    EXPECT_EQ(chan->available(), 2u);
+}; /* reclaim_after_the_loop_delete_keeps_the_retained */
+
+TEST_F(channel_loop, destroy_reclaims_the_pending)
+{
+    ASSERT_EQ(chan->post(0, 1), ESP_OK);
+    reg.unreg();
+    EXPECT_EQ(sample::live, 1);
+    chan.reset();
+    EXPECT_EQ(sample::live, 0);
+}; /* destroy_reclaims_the_pending */
@@ -0,0 +1,125 @@
+/*!@file test_charclass.cpp
+ *
+ * @brief Tests of the character classes engine: the table against <cctype>, the SWAR scanning
+ *	  against the byte-by-byte reference at all lengths & alignments
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <random>
+#include <string>
+
+#include "astring.h"
+#include "charclass.hpp"
+
+
+namespace chr = astr::chr;
+
+namespace
+{
+
+size_t ref_span(std::string_view s, uint16_t mask, bool inside)
+{
+	size_t i = 0;
+
+    while (i < s.length() && chr::is(s[i], mask) == inside)
+	i++;
+    return i;
+}; /* ref_span() */
+
+size_t ref_rspan(std::string_view s, uint16_t mask)
+{
+	size_t i = 0;
+
+    while (i < s.length() && chr::is(s[s.length() - 1 - i], mask))
+	i++;
+    return i;
+}; /* ref_rspan() */
+
+}; /* namespace */
+
+
+TEST(charclass, table_matches_the_c_locale)
+{
+    for (int c = 0; c < 256; c++)
+    {
+	    char ch = static_cast<char>(c);
+	    bool ascii = c < 0x80;
+
+	EXPECT_EQ(chr::is(ch, chr::space), ascii && std::isspace(c)) << c;
+	EXPECT_EQ(chr::is(ch, chr::digit), ascii && std::isdigit(c)) << c;
+	EXPECT_EQ(chr::is(ch, chr::xdigit), ascii && std::isxdigit(c)) << c;
+	EXPECT_EQ(chr::is(ch, chr::upper), ascii && std::isupper(c)) << c;
+	EXPECT_EQ(chr::is(ch, chr::lower), ascii && std::islower(c)) << c;
+	EXPECT_EQ(chr::is(ch, chr::punct), ascii && std::ispunct(c)) << c;
+	EXPECT_EQ(chr::is(ch, chr::under), c == '_') << c;
+	EXPECT_EQ(chr::is(ch, chr::zero), c == '0') << c;
+    }
+}
+
+///@brief the SWAR paths against the reference: random strings of the class & non-class chars,
+/// every length up to the few words & every alignment of the start
+TEST(charclass, swar_matches_the_reference)
+{
+	const uint16_t masks[] = {chr::space, chr::digit, chr::zero, chr::under, chr::space | chr::under,
+				  chr::digit | chr::space | chr::under, chr::zero | chr::space, chr::alpha, chr::xdigit};
+	// the class chars are frequent to get the long spans
+	const std::string alphabet = std::string("  \t\r\n\v\f0000011234567899___xaZ.:/\x80\xb0\xff") + '\0';
+	std::mt19937 rnd(12345);
+	char buf[64 + 8];
+
+    for (int round = 0; round < 2000; round++)
+    {
+	for (char& c: buf)
+	    c = alphabet[rnd() % alphabet.length()];
+	for (uint16_t mask: masks)
+	{
+		// the long spans of the class: fill the middle by the one class char
+		char fill = chr::is(' ', mask)? ' ': chr::is('0', mask)? '0': chr::is('_', mask)? '_': 'a';
+		size_t from = rnd() % 32, to = from + rnd() % 40;
+
+	    for (size_t i = from; i < to && i < sizeof(buf); i++)
+		buf[i] = fill;
+	    for (size_t offset = 0; offset < 8; offset++)
+		for (size_t len = 0; offset + len <= sizeof(buf); len += 1 + len / 16)
+		{
+			std::string_view s(buf + offset, len);
+
+		    ASSERT_EQ(chr::span(s, mask), ref_span(s, mask, true)) << "mask " << mask << " len " << len;
+		    ASSERT_EQ(chr::cspan(s, mask), ref_span(s, mask, false)) << "mask " << mask << " len " << len;
+		    ASSERT_EQ(chr::rspan(s, mask), ref_rspan(s, mask)) << "mask " << mask << " len " << len;
+		}
+	}
+    }
+}
+
+TEST(charclass, all_and_any)
+{
+    EXPECT_TRUE(chr::all("", chr::digit));
+    EXPECT_FALSE(chr::any("", chr::digit));
+    EXPECT_TRUE(chr::all("0123456789", chr::digit));
+    EXPECT_FALSE(chr::all("01234a6789", chr::digit));
+    EXPECT_TRUE(chr::any("abc 7", chr::digit));
+}
+
+TEST(charclass, string_predicates)
+{
+    EXPECT_TRUE(astr::is_space(""));
+    EXPECT_TRUE(astr::is_space(" \t\r\n"));
+    EXPECT_FALSE(astr::is_space("  x "));
+
+    EXPECT_TRUE(astr::is_digitex("123"));
+    EXPECT_TRUE(astr::is_digitex(" 1_000 000 "));
+    EXPECT_FALSE(astr::is_digitex(" _ "));
+    EXPECT_FALSE(astr::is_digitex("12a"));
+    EXPECT_FALSE(astr::is_digitex(""));
+
+    EXPECT_TRUE(astr::is_zero("0"));
+    EXPECT_TRUE(astr::is_zero(" 0_000 "));
+    EXPECT_FALSE(astr::is_zero("010"));
+    EXPECT_FALSE(astr::is_zero("   "));
+}
@@ -0,0 +1,282 @@
+/*!@file test_coalesce.cpp
+ *
+ * @brief Tests of the coalescing event delivery on the local event loop: latest, merge & batch policies,
+ *	  the pushes from the tasks & from the "ISR", the time window, the repost after the full loop queue
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "host.hpp"
+#include "event_ctrl.hpp"
+#include "event_registry.hpp"
+#include "event_coalesce.hpp"
+
+
+using namespace std::chrono_literals;
+
+ESP_EVENT_DEFINE_BASE(COALESCE_TEST_EVENT);
+
+namespace
+{
+
+struct sample
+{
+    int32_t rssi;
+    uint32_t seq;
+}; /* struct sample */
+
+struct last_sample: event::coalesce::latest<sample>
+{
+    using latest::latest;
+    void receive(const sample& v, uint32_t drops) override {
+	calls++;
+	value = v;
+	dropped += drops; };
+
+    int calls = 0;
+    sample value {};
+    uint32_t dropped = 0;
+}; /* struct last_sample */
+
+template <typename Merge = std::plus<int>>
+struct merged: event::coalesce::merge<int, Merge>
+{
+    using event::coalesce::merge<int, Merge>::merge;
+    void receive(const int& v, uint32_t n) override {
+	calls++;
+	value = v;
+	count += n; };
+
+    int calls = 0;
+    int value = 0;
+    uint32_t count = 0;
+}; /* struct merged */
+
+struct maximum
+{
+    int operator()(int a, int b) const { return std::max(a, b); };
+}; /* struct maximum */
+
+struct edges: event::coalesce::batch<uint16_t, 8>
+{
+    using batch::batch;
+    void receive(std::span<const uint16_t> values, uint32_t drops) override {
+	calls++;
+	received.insert(received.end(), values.begin(), values.end());
+	dropped += drops; };
+
+    int calls = 0;
+    std::vector<uint16_t> received;
+    uint32_t dropped = 0;
+}; /* struct edges */
+
+///@brief the event loop w/o the task: dispatched by the test itself
+class coalesce_loop: public ::testing::Test
+{
+protected:
+    void SetUp() override {
+	    esp_event_loop_args_t args = {16, nullptr, 0, 0, 0};
+
+	ASSERT_EQ(esp_event_loop_create(&args, &loop), ESP_OK); };
+    void TearDown() override { esp_event_loop_delete(loop); };
+
+    void dispatch() { esp_event_loop_run(loop, 0); };
+
+    esp_event_loop_handle_t loop;
+    event::registry<4> reg;
+}; /* class coalesce_loop */
+
+}; /* namespace */
+
+
+TEST_F(coalesce_loop, latest_wins)
+{
+	last_sample h(loop, COALESCE_TEST_EVENT, 1);
+	auto t = reg.enroll_to(h);
+
+    for (uint32_t i = 0; i < 100; i++)
+	h.push({-40 - int32_t(i), i});
+    EXPECT_EQ(h.posts(), 1u);
+    EXPECT_EQ(h.pushes(), 100u);
+    dispatch();
+    EXPECT_EQ(h.calls, 1);
+    EXPECT_EQ(h.value.seq, 99u);
+    EXPECT_EQ(h.value.rssi, -139);
+    EXPECT_EQ(h.dropped, 99u);
+
+    // the next push after the delivery posts again
+    h.push({-10, 100});
+    EXPECT_EQ(h.posts(), 2u);
+    dispatch();
+    EXPECT_EQ(h.calls, 2);
+    EXPECT_EQ(h.value.seq, 100u);
+    EXPECT_EQ(h.dropped, 99u);
+}; /* latest_wins */
+
+TEST_F(coalesce_loop, merge_sums_the_burst)
+{
+	merged<> h(loop, COALESCE_TEST_EVENT, 2);
+	auto t = reg.enroll_to(h);
+
+    for (int i = 1; i <= 100; i++)
+	h.push(i);
+    EXPECT_EQ(h.posts(), 1u);
+    dispatch();
+    EXPECT_EQ(h.calls, 1);
+    EXPECT_EQ(h.value, 5050);
+    EXPECT_EQ(h.count, 100u);
+
+    // the accumulated value restarts from the first pushed value after the delivery
+    h.push(7);
+    dispatch();
+    EXPECT_EQ(h.value, 7);
+}; /* merge_sums_the_burst */
+
+TEST_F(coalesce_loop, merge_custom_functor)
+{
+	merged<maximum> h(loop, COALESCE_TEST_EVENT, 2);
+	auto t = reg.enroll_to(h);
+
+    for (int v: {-5, 3, 17, -2, 9})
+	h.push(v);
+    dispatch();
+    EXPECT_EQ(h.value, 17);
+    EXPECT_EQ(h.count, 5u);
+}; /* merge_custom_functor */
+
+TEST_F(coalesce_loop, merge_concurrent_producers_lose_nothing)
+{
+	constexpr int producers = 4, pushes = 20000;
+	merged<> h(loop, COALESCE_TEST_EVENT, 2);
+	auto t = reg.enroll_to(h);
+	std::atomic<int> running {producers};
+	std::vector<std::thread> threads;
+	long long sum = 0;
+	uint32_t count = 0;
+
+    for (int p = 0; p < producers; p++)
+	threads.emplace_back([&] {
+	    for (int i = 0; i < pushes; i++)
+		h.push(1);
+	    running--;
+	});
+    // the handler runs concurrently with the producers: the merges outside of the lock are retried
+    while (running)
+    {
+	dispatch();
+	sum += std::exchange(h.value, 0);
+	count += std::exchange(h.count, 0);
+    }
+    for (auto& th: threads)
+	th.join();
+    dispatch();
+    sum += h.value;
+    count += h.count;
+    EXPECT_EQ(sum, producers * pushes);
+    EXPECT_EQ(count, uint32_t(producers * pushes));
+}; /* merge_concurrent_producers_lose_nothing */
+
+TEST_F(coalesce_loop, batch_keeps_the_order_and_counts_drops)
+{
+	edges h(loop, COALESCE_TEST_EVENT, 3);
+	auto t = reg.enroll_to(h);
+
+    for (uint16_t i = 0; i < 10; i++)
+	EXPECT_EQ(h.push(i), i < edges::capacity()) << "push " << i;
+    EXPECT_EQ(h.posts(), 1u);
+    dispatch();
+    EXPECT_EQ(h.calls, 1);
+    EXPECT_EQ(h.received, (std::vector<uint16_t> {0, 1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(h.dropped, 2u);
+
+    // the other buffer is filled after the swap
+    for (uint16_t i = 10; i < 13; i++)
+	EXPECT_TRUE(h.push(i));
+    dispatch();
+    EXPECT_EQ(h.calls, 2);
+    EXPECT_EQ(h.received.size(), 11u);
+    EXPECT_EQ(h.received.back(), 12);
+}; /* batch_keeps_the_order_and_counts_drops */
+
+TEST_F(coalesce_loop, push_from_isr)
+{
+	last_sample l(loop, COALESCE_TEST_EVENT, 1);
+	merged<> m(loop, COALESCE_TEST_EVENT, 2);
+	edges b(loop, COALESCE_TEST_EVENT, 3);
+	auto tl = reg.enroll_to(l);
+	auto tm = reg.enroll_to(m);
+	auto tb = reg.enroll_to(b);
+	BaseType_t woken = pdFALSE;
+
+    {
+	    host::isr_scope isr;
+
+	for (int i = 0; i < 5; i++)
+	{
+	    l.push_from_isr({-50, uint32_t(i)}, &woken);
+	    m.push_from_isr(i, &woken);
+	    EXPECT_TRUE(b.push_from_isr(uint16_t(i), &woken));
+	}
+    }
+    EXPECT_EQ(woken, pdTRUE);
+    EXPECT_EQ(l.posts(), 1u);
+    EXPECT_EQ(m.posts(), 1u);
+    EXPECT_EQ(b.posts(), 1u);
+    dispatch();
+    EXPECT_EQ(l.value.seq, 4u);
+    EXPECT_EQ(l.dropped, 4u);
+    EXPECT_EQ(m.value, 10);
+    EXPECT_EQ(b.received, (std::vector<uint16_t> {0, 1, 2, 3, 4}));
+}; /* push_from_isr */
+
+TEST_F(coalesce_loop, window_delays_the_post)
+{
+	merged<> h(loop, COALESCE_TEST_EVENT, 2, 30000);
+	auto t = reg.enroll_to(h);
+
+    h.push(1);
+    h.push(2);
+    EXPECT_EQ(h.posts(), 0u);
+    std::this_thread::sleep_for(10ms);
+    h.push(3);
+    EXPECT_EQ(h.posts(), 0u);
+    for (int i = 0; i < 100 && !h.posts(); i++)
+	std::this_thread::sleep_for(5ms);
+    EXPECT_EQ(h.posts(), 1u);
+    dispatch();
+    EXPECT_EQ(h.calls, 1);
+    EXPECT_EQ(h.value, 6);
+}; /* window_delays_the_post */
+
+TEST_F(coalesce_loop, full_queue_reposts_on_the_next_push)
+{
+	merged<> h(loop, COALESCE_TEST_EVENT, 2);
+	auto t = reg.enroll_to(h);
+
+    for (int i = 0; i < 16; i++)
+	ASSERT_EQ(esp_event_post_to(loop, COALESCE_TEST_EVENT, 9, nullptr, 0, 0), ESP_OK);
+
+    // the queue is full: the post fails, the accumulated value is kept
+    h.push(1);
+    EXPECT_EQ(h.posts(), 0u);
+    dispatch();
+    EXPECT_EQ(h.calls, 0);
+    h.push(2);
+    EXPECT_EQ(h.posts(), 1u);
+    dispatch();
+    EXPECT_EQ(h.calls, 1);
+    EXPECT_EQ(h.value, 3);
+    EXPECT_EQ(h.count, 2u);
+}; /* full_queue_reposts_on_the_next_push */
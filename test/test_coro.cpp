@@ -0,0 +1,189 @@
+/*!@file test_coro.cpp
+ *
+ * @brief Tests of the C++20 coroutines support: the executor driven manually & by it's own task,
+ *	  the awaitable semaphores & events, the behavior outside of the executor
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "asemaphore"
+#include "amutex"
+#include "event_ctrl.hpp"
+#include "coro.hpp"
+
+
+using aso::coro::async;
+using aso::coro::executor;
+using aso::coro::task;
+
+ESP_EVENT_DEFINE_BASE(CORO_TEST_EVENT);
+
+namespace
+{
+
+///@brief session: waits for the semaphore n times & counts the resumes
+task session(async<asemaphore>& sem, int n, std::atomic<int>& resumed, executor** where = nullptr)
+{
+    for (int i = 0; i < n; i++)
+    {
+	co_await sem.async_take();
+	if (where)
+	    *where = executor::current();
+	resumed++;
+    }
+}; /* session() */
+
+task yielding(std::vector<int>& order, int id)
+{
+    order.push_back(id);
+    co_await executor::yield();
+    order.push_back(id + 10);
+}; /* yielding() */
+
+template <int32_t Id>
+task waiting_event(esp_event_loop_handle_t loop, esp_err_t& err, int32_t& fired, std::atomic<bool>& done)
+{
+	event::awaitable<CORO_TEST_EVENT, Id> ev(loop);
+
+    err = co_await ev;
+    fired = ev.event_id();
+    done = true;
+}; /* waiting_event() */
+
+}; /* namespace */
+
+
+TEST(coro, manual_executor_resumes_at_give)
+{
+	executor exec(8);
+	async<asemaphore> sem(false);
+	std::atomic<int> resumed {0};
+	executor* where = nullptr;
+
+    ASSERT_TRUE(exec.created());
+    ASSERT_TRUE(exec.spawn(session(sem, 2, resumed, &where)));
+    // start: runs up to the first co_await
+    ASSERT_TRUE(exec.run_once(0));
+    EXPECT_EQ(resumed, 0);
+    EXPECT_FALSE(exec.run_once(0));
+
+    sem.Give();
+    ASSERT_TRUE(exec.run_once(0));
+    EXPECT_EQ(resumed, 1);
+    EXPECT_EQ(where, &exec);
+    EXPECT_EQ(executor::current(), nullptr);
+
+    sem.Give();
+    ASSERT_TRUE(exec.run_once(0));
+    EXPECT_EQ(resumed, 2);
+    EXPECT_FALSE(exec.run_once(0));
+}
+
+TEST(coro, given_count_is_taken_wo_suspending)
+{
+	executor exec(8);
+	async<asemaphore> sem(false);
+	std::atomic<int> resumed {0};
+
+    sem.Give();
+    exec.spawn(session(sem, 1, resumed));
+    // the start only: the co_await is ready
+    ASSERT_TRUE(exec.run_once(0));
+    EXPECT_EQ(resumed, 1);
+    EXPECT_FALSE(exec.run_once(0));
+}
+
+TEST(coro, many_sessions_in_one_task)
+{
+	constexpr int sessions = 200;
+	executor exec(sessions + 8);
+	async<asemaphore> sem(sessions, 0);
+	std::atomic<int> resumed {0};
+
+    for (int i = 0; i < sessions; i++)
+	ASSERT_TRUE(exec.spawn(session(sem, 1, resumed)));
+    ASSERT_TRUE(exec.start("coro_test"));
+    for (int i = 0; i < sessions; i++)
+	sem.Give();
+    for (int i = 0; i < 200 && resumed < sessions; i++)
+	vTaskDelay(1);
+    EXPECT_EQ(resumed, sessions);
+}
+
+TEST(coro, yield_reschedules_to_the_end)
+{
+	executor exec(8);
+	std::vector<int> order;
+
+    exec.spawn(yielding(order, 1));
+    exec.spawn(yielding(order, 2));
+    while (exec.run_once(0))
+	;
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 11, 12}));
+}
+
+///@brief the coroutine resumed directly by the task, not by the executor: nothing is scheduled, the take blocks the task
+TEST(coro, outside_of_the_executor)
+{
+	async<asemaphore> sem(false);
+	std::atomic<int> resumed {0};
+	std::vector<int> order;
+
+    ASSERT_EQ(executor::current(), nullptr);
+    yielding(order, 1).release().resume();
+    EXPECT_EQ(order, (std::vector<int>{1, 11}));
+
+	std::thread giver([&] {
+	    vTaskDelay(2);
+	    sem.Give();
+	});
+
+    session(sem, 1, resumed).release().resume();
+    EXPECT_EQ(resumed, 1);
+    giver.join();
+}
+
+TEST(coro, awaitable_event)
+{
+	esp_event_loop_args_t args = {8, "coro_loop", 5, 4096, tskNO_AFFINITY};
+	esp_event_loop_handle_t loop;
+	executor exec(8);
+	esp_err_t err = ESP_FAIL;
+	int32_t fired = -1;
+	std::atomic<bool> done {false};
+
+    ASSERT_EQ(esp_event_loop_create(&args, &loop), ESP_OK);
+    ASSERT_TRUE(exec.start("coro_test"));
+    exec.spawn(waiting_event<ESP_EVENT_ANY_ID>(loop, err, fired, done));
+    vTaskDelay(2);
+    EXPECT_FALSE(done);
+    esp_event_post_to(loop, CORO_TEST_EVENT, 7, nullptr, 0, portMAX_DELAY);
+    for (int i = 0; i < 100 && !done; i++)
+	vTaskDelay(1);
+    EXPECT_TRUE(done);
+    EXPECT_EQ(err, ESP_OK);
+    EXPECT_EQ(fired, 7);
+    esp_event_loop_delete(loop);
+}
+
+TEST(coro, awaitable_event_outside_of_the_executor_asserts)
+{
+	esp_err_t err;
+	int32_t fired;
+	std::atomic<bool> done {false};
+
+    EXPECT_DEATH(waiting_event<1>(nullptr, err, fired, done).release().resume(), "outside of the aso::coro::executor");
+}
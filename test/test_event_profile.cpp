@@ -0,0 +1,164 @@
+/*!@file test_event_profile.cpp
+ *
+ * @brief Tests of the profiling policies of the event::ctrl on the local event loop: the log2 histograms,
+ *	  the execution time & budget overruns, the post-to-dispatch latency of the stamped events
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <array>
+#include <chrono>
+#include <numeric>
+#include <thread>
+
+#include "event_ctrl.hpp"
+#include "event_profile.hpp"
+
+
+using namespace std::chrono_literals;
+
+ESP_EVENT_DEFINE_BASE(PROFILE_TEST_EVENT);
+
+namespace
+{
+
+///@brief the handler, busy for the time of the payload, us
+struct busy: event::handler::base
+{
+    using base::base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void* data) override {
+	calls++;
+	if (!with_payload)
+	    return;
+	payload = *static_cast<int*>(data);
+	std::this_thread::sleep_for(std::chrono::microseconds(payload)); };
+
+    bool with_payload = true;	///< the stamped event w/o payload has no data after the stamp
+    int payload = 0;
+    int calls = 0;
+}; /* struct busy */
+
+busy plain(PROFILE_TEST_EVENT, 1);
+busy timed(PROFILE_TEST_EVENT, 2);
+busy stamped(PROFILE_TEST_EVENT, 3);
+
+using plain_ctrl = event::ctrl<plain>;
+// the wide budget: the handler w/o work is in it even on the loaded host, the long one is over it surely
+using timed_ctrl = event::ctrl<timed, event::profile::timed<50000>>;
+using stamped_ctrl = event::ctrl<stamped, event::profile::timed<1000, true>>;
+
+template <size_t Bins>
+uint32_t total(const event::profile::histogram<Bins>& h)
+{
+	std::array<uint32_t, Bins> counts;
+
+    h.snapshot(counts);
+    return std::accumulate(counts.begin(), counts.end(), 0u);
+}; /* total() */
+
+///@brief the event loop w/o the task: dispatched by the test itself
+class profile_loop: public ::testing::Test
+{
+protected:
+    void SetUp() override {
+	    esp_event_loop_args_t args = {16, nullptr, 0, 0, 0};
+
+	ASSERT_EQ(esp_event_loop_create(&args, &loop), ESP_OK); };
+    void TearDown() override { esp_event_loop_delete(loop); };
+
+    void dispatch() { esp_event_loop_run(loop, 0); };
+
+    esp_event_loop_handle_t loop;
+}; /* class profile_loop */
+
+}; /* namespace */
+
+
+TEST(histogram, log2_bins)
+{
+	event::profile::histogram<8> h;
+	std::array<uint32_t, 8> counts;
+
+    for (uint32_t us: {0u, 1u, 2u, 3u, 4u, 100u, 127u, 128u, 1000000u})
+	h.add(us);
+    h.snapshot(counts);
+    // the last bin is unbounded: [64, ...) us
+    EXPECT_EQ(counts, (std::array<uint32_t, 8>{1, 1, 2, 1, 0, 0, 0, 4}));
+    EXPECT_EQ(h.upper(0), 1u);
+    EXPECT_EQ(h.upper(3), 8u);
+    EXPECT_EQ(h.upper(7), 0u);
+    h.reset();
+    EXPECT_EQ(total(h), 0u);
+}
+
+TEST_F(profile_loop, none_is_zero_size)
+{
+    EXPECT_TRUE(std::is_empty_v<event::profile::none>);
+    ASSERT_EQ(plain_ctrl::enroll_to(loop), ESP_OK);
+
+	int payload = 0;
+
+    esp_event_post_to(loop, PROFILE_TEST_EVENT, 1, &payload, sizeof(payload), 0);
+    dispatch();
+    EXPECT_EQ(plain.calls, 1);
+    plain_ctrl::unreg_from(loop);
+}
+
+TEST_F(profile_loop, execution_time_and_overruns)
+{
+    timed_ctrl::profiling.reset();
+    ASSERT_EQ(timed_ctrl::enroll_to(loop), ESP_OK);
+    for (int us: {0, 10, 60000})
+    {
+	esp_event_post_to(loop, PROFILE_TEST_EVENT, 2, &us, sizeof(us), 0);
+	dispatch();
+    }
+    EXPECT_EQ(timed.calls, 3);
+    EXPECT_EQ(total(timed_ctrl::profiling.exec), 3u);
+    EXPECT_EQ(timed_ctrl::profiling.overruns(), 1u);
+    EXPECT_GE(timed_ctrl::profiling.worst(), 60000u);
+    EXPECT_EQ(timed_ctrl::profiling.budget(), 50000u);
+    // not stamped: no latency
+    EXPECT_EQ(total(timed_ctrl::profiling.latency), 0u);
+
+    timed_ctrl::profiling.reset();
+    EXPECT_EQ(total(timed_ctrl::profiling.exec), 0u);
+    EXPECT_EQ(timed_ctrl::profiling.overruns(), 0u);
+    EXPECT_EQ(timed_ctrl::profiling.worst(), 0u);
+    timed_ctrl::unreg_from(loop);
+}
+
+TEST_F(profile_loop, stamped_latency_and_payload)
+{
+    stamped_ctrl::profiling.reset();
+    ASSERT_EQ(stamped_ctrl::enroll_to(loop), ESP_OK);
+    ASSERT_EQ(event::profile::post_to(loop, PROFILE_TEST_EVENT, 3, 42, 0), ESP_OK);
+    // the event waits in the queue for 2 ms at least
+    std::this_thread::sleep_for(2ms);
+    dispatch();
+    EXPECT_EQ(stamped.payload, 42);
+
+	std::array<uint32_t, 16> counts;
+
+    stamped_ctrl::profiling.latency.snapshot(counts);
+    EXPECT_EQ(total(stamped_ctrl::profiling.latency), 1u);
+    // 2 ms & more: the bins from [1024, 2048) us
+    EXPECT_EQ(std::accumulate(counts.begin(), counts.begin() + 11, 0u), 0u);
+
+    // w/o the payload: the stamp only
+	int calls = stamped.calls;
+
+    stamped.with_payload = false;
+    ASSERT_EQ(event::profile::post_to(loop, PROFILE_TEST_EVENT, 3, 0), ESP_OK);
+    dispatch();
+    EXPECT_EQ(stamped.calls, calls + 1);
+    EXPECT_EQ(total(stamped_ctrl::profiling.latency), 2u);
+    stamped_ctrl::unreg_from(loop);
+}
@@ -0,0 +1,195 @@
+/*!@file test_executor.cpp
+ *
+ * @brief Tests of the prioritized multi-loop event executor: the stats of the own events of the executor,
+ *	  the bounded latency of the urgent events while the low priority loop is saturated
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "asemaphore"
+#include "event_ctrl.hpp"
+#include "event_executor.hpp"
+
+
+using namespace std::chrono_literals;
+
+ESP_EVENT_DEFINE_BASE(FOREIGN_TEST_EVENT);
+
+namespace
+{
+
+using exec2 = event::executor<2>;
+using exec1 = event::executor<1>;
+
+enum ids: int32_t { urgent_id = 1, bulk_id, late_id, gate_id, count_id };
+
+///@brief the handler of the slow work, e.g. the flash writing: 2 ms per event
+struct slow: event::handler::loop_base
+{
+    using loop_base::loop_base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void*) override {
+	std::this_thread::sleep_for(2ms);
+	calls++; };
+
+    std::atomic<int> calls {0};
+}; /* struct slow */
+
+///@brief the handler of the urgent events: the post time is the payload, the latency is measured up to the call
+struct timing: event::handler::loop_base
+{
+    using loop_base::loop_base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void* data) override {
+	int64_t latency = esp_timer_get_time() - *static_cast<int64_t*>(data);
+	worst = std::max<int64_t>(worst, latency);
+	calls++; };
+
+    int64_t worst = 0;		///< the worst latency, us
+    std::atomic<int> calls {0};
+}; /* struct timing */
+
+///@brief the handler blocks the loop up to the gate is opened
+struct gated: event::handler::loop_base
+{
+    using loop_base::loop_base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void*) override { gate.Take(); };
+
+    asemaphore gate {false};
+}; /* struct gated */
+
+struct counting: event::handler::loop_base
+{
+    using loop_base::loop_base;
+    void instance_handler(void*, esp_event_base_t, int32_t, void*) override { calls++; };
+
+    std::atomic<int> calls {0};
+}; /* struct counting */
+
+slow bulk(nullptr, exec2::event_base(), bulk_id);
+timing urgent(nullptr, exec2::event_base(), urgent_id);
+timing late(nullptr, exec2::event_base(), late_id);
+
+gated gate(nullptr, exec1::event_base(), gate_id);
+counting own(nullptr, exec1::event_base(), count_id);
+counting foreign(nullptr, FOREIGN_TEST_EVENT, 1);
+
+///@brief wait for the condition up to 5 s
+template <typename Pred>
+bool eventually(Pred pred)
+{
+    for (int i = 0; i < 5000 && !pred(); i++)
+	std::this_thread::sleep_for(1ms);
+    return pred();
+}; /* eventually() */
+
+///@brief post the urgent event, stamped by the current time
+esp_err_t post_stamped(exec2& ex, size_t cls, int32_t id)
+{
+	int64_t now = esp_timer_get_time();
+
+    return ex.post(cls, id, &now, sizeof(now), portMAX_DELAY);
+}; /* post_stamped() */
+
+}; /* namespace */
+
+
+TEST(executor, stats_count_own_events_only)
+{
+	exec1 ex(std::array<event::loop_config, 1> {{ {"exec_test", 5, tskNO_AFFINITY, 4} }});
+
+    ASSERT_TRUE(ex.created());
+    ASSERT_EQ(ex.enroll<gate>(0), ESP_OK);
+    ASSERT_EQ(ex.enroll<own>(0), ESP_OK);
+    ASSERT_EQ(ex.enroll<foreign>(0), ESP_OK);
+
+    // the loop is blocked in the gate handler, the queue is free
+    ASSERT_EQ(ex.post(0, gate_id), ESP_OK);
+    ASSERT_TRUE(eventually([&] { return ex.stats(0).dispatched == 1; }));
+
+    // the foreign event takes the queue slot, but is not counted
+    ASSERT_EQ(esp_event_post_to(ex.loop(0), FOREIGN_TEST_EVENT, 1, nullptr, 0, 0), ESP_OK);
+    for (int i = 0; i < 3; i++)
+	ASSERT_EQ(ex.post(0, count_id), ESP_OK);
+    EXPECT_NE(ex.post(0, count_id), ESP_OK);
+
+	event::loop_stats st = ex.stats(0);
+
+    EXPECT_EQ(st.posted, 4u);
+    EXPECT_EQ(st.dispatched, 1u);
+    EXPECT_EQ(st.failed, 1u);
+    EXPECT_EQ(st.capacity, 4);
+    EXPECT_EQ(st.backlog(), 3u);
+
+    gate.gate.Give();
+    ASSERT_TRUE(eventually([&] { return own.calls == 3 && foreign.calls == 1; }));
+    st = ex.stats(0);
+    EXPECT_EQ(st.dispatched, 4u);
+    EXPECT_EQ(st.backlog(), 0u);
+
+    event::ctrl<gate>::unreg_from();
+    event::ctrl<own>::unreg_from();
+    event::ctrl<foreign>::unreg_from();
+}; /* stats_count_own_events_only */
+
+TEST(executor, urgent_latency_bounded_while_bulk_saturated)
+{
+	constexpr int bulk_events = 60, urgent_events = 20;
+	exec2 ex(std::array<event::loop_config, 2> {{ {"urgent", 10, tskNO_AFFINITY, 16}, {"bulk", 2, tskNO_AFFINITY, bulk_events} }});
+
+    ASSERT_TRUE(ex.created());
+    ASSERT_EQ(ex.enroll<urgent>(0), ESP_OK);
+    ASSERT_EQ(ex.enroll<bulk>(1), ESP_OK);
+
+    // 120 ms of the work for the bulk loop
+    for (int i = 0; i < bulk_events; i++)
+	ASSERT_EQ(ex.post(1, bulk_id), ESP_OK);
+    for (int i = 0; i < urgent_events; i++)
+    {
+	ASSERT_EQ(post_stamped(ex, 0, urgent_id), ESP_OK);
+	std::this_thread::sleep_for(2ms);
+    }
+    ASSERT_TRUE(eventually([] { return urgent.calls == urgent_events; }));
+
+    // the bulk loop is still behind, the urgent events were not queued after it
+    EXPECT_GT(ex.stats(1).backlog(), 0u);
+    EXPECT_LT(urgent.worst, 20000) << "worst urgent latency, us";
+    EXPECT_EQ(ex.stats(0).backlog(), 0u);
+
+    ASSERT_TRUE(eventually([&] { return bulk.calls == bulk_events; }));
+    event::ctrl<urgent>::unreg_from();
+    event::ctrl<bulk>::unreg_from();
+}; /* urgent_latency_bounded_while_bulk_saturated */
+
+TEST(executor, same_loop_latency_grows_with_backlog)
+{
+	constexpr int bulk_events = 30;
+	exec2 ex(std::array<event::loop_config, 2> {{ {"urgent", 10, tskNO_AFFINITY, 16}, {"bulk", 2, tskNO_AFFINITY, bulk_events + 1} }});
+
+    ASSERT_TRUE(ex.created());
+    ASSERT_EQ(ex.enroll<late>(1), ESP_OK);
+    ASSERT_EQ(ex.enroll<bulk>(1), ESP_OK);
+
+    // w/o the executor routing the urgent event waits for the 60 ms of the bulk work
+    for (int i = 0; i < bulk_events; i++)
+	ASSERT_EQ(ex.post(1, bulk_id), ESP_OK);
+    ASSERT_EQ(post_stamped(ex, 1, late_id), ESP_OK);
+    ASSERT_TRUE(eventually([] { return late.calls == 1; }));
+    EXPECT_GE(late.worst, 2000 * (bulk_events - 1));
+
+    event::ctrl<late>::unreg_from();
+    event::ctrl<bulk>::unreg_from();
+}; /* same_loop_latency_grows_with_backlog */
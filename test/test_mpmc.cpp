@@ -0,0 +1,202 @@
+/*!@file test_mpmc.cpp
+ *
+ * @brief Tests of the bounded lock-free MPMC queue & of it's blocking adapter: the FIFO order, the wrap around,
+ *	  the many producers & consumers w/o the lost or duplicated items
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "asemaphore"
+#include "blocking.hpp"
+#include "mpmc_queue.hpp"
+
+
+TEST(mpmc_queue, fifo_full_and_empty)
+{
+	aso::mpmc_queue<int, 4> queue;
+	int v;
+
+    EXPECT_EQ(queue.capacity(), 4u);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(v));
+    for (int i = 0; i < 4; i++)
+	EXPECT_TRUE(queue.push(i));
+    EXPECT_TRUE(queue.full());
+    EXPECT_FALSE(queue.push(4));
+    EXPECT_EQ(queue.size(), 4u);
+    for (int i = 0; i < 4; i++)
+    {
+	ASSERT_TRUE(queue.pop(v));
+	EXPECT_EQ(v, i);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpmc_queue, wraps_around)
+{
+	aso::mpmc_queue<unsigned, 8>::stat queue;
+	unsigned v;
+
+    for (unsigned i = 0; i < 1000; i++)
+    {
+	ASSERT_TRUE(queue.push(i));
+	ASSERT_TRUE(queue.push(i + 1));
+	ASSERT_TRUE(queue.pop(v));
+	EXPECT_EQ(v, i);
+	ASSERT_TRUE(queue.pop(v));
+	EXPECT_EQ(v, i + 1);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpmc_queue, move_only_items)
+{
+	aso::mpmc_queue<std::unique_ptr<int>, 2> queue;
+	std::unique_ptr<int> v;
+
+    ASSERT_TRUE(queue.push(std::make_unique<int>(1)));
+    ASSERT_TRUE(queue.push(std::make_unique<int>(2)));
+
+    // the item is not moved from if the queue is full
+	auto rejected = std::make_unique<int>(3);
+
+    EXPECT_FALSE(queue.push(std::move(rejected)));
+    ASSERT_TRUE(rejected);
+    ASSERT_TRUE(queue.pop(v));
+    EXPECT_EQ(*v, 1);
+    ASSERT_TRUE(queue.pop(v));
+    EXPECT_EQ(*v, 2);
+}
+
+namespace
+{
+
+///@brief the item of the stress tests: the producer & the sequence number of it
+struct tagged
+{
+    uint32_t producer;
+    uint32_t seq;
+}; /* struct tagged */
+
+}; /* namespace */
+
+///@brief producers x consumers
+class mpmc_stress: public ::testing::TestWithParam<std::tuple<unsigned, unsigned>> {};
+
+TEST_P(mpmc_stress, every_item_once_in_producer_order)
+{
+	constexpr uint32_t per_producer = 20000;
+	const auto [producers, consumers] = GetParam();
+	aso::mpmc_queue<tagged, 64> queue;
+	std::atomic<uint32_t> consumed {0};
+	std::vector<std::vector<uint32_t>> seen(producers, std::vector<uint32_t>(per_producer, 0));
+	std::atomic<unsigned> disorders {0};
+	std::vector<std::thread> threads;
+
+    for (unsigned c = 0; c < consumers; c++)
+	threads.emplace_back([&] {
+		std::vector<int64_t> last(producers, -1);
+		tagged v;
+
+	    while (consumed.load(std::memory_order_relaxed) < producers * per_producer)
+		if (queue.pop(v))
+		{
+		    consumed.fetch_add(1, std::memory_order_relaxed);
+		    // the items of the one producer are popped by the one consumer in the push order
+		    if (int64_t(v.seq) <= last[v.producer])
+			disorders++;
+		    last[v.producer] = v.seq;
+		    __atomic_fetch_add(&seen[v.producer][v.seq], 1, __ATOMIC_RELAXED);
+		}
+		else
+		    std::this_thread::yield();
+	});
+    for (unsigned p = 0; p < producers; p++)
+	threads.emplace_back([&, p] {
+	    for (uint32_t i = 0; i < per_producer;)
+		if (queue.push(tagged {p, i}))
+		    i++;
+		else
+		    std::this_thread::yield();
+	});
+    for (auto& t: threads)
+	t.join();
+
+	unsigned lost = 0, duplicated = 0;
+
+    for (auto& s: seen)
+	for (auto n: s)
+	{
+	    lost += n == 0;
+	    duplicated += n > 1;
+	}
+    EXPECT_EQ(lost, 0u);
+    EXPECT_EQ(duplicated, 0u);
+    EXPECT_EQ(disorders, 0u);
+    EXPECT_TRUE(queue.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(mpmc_queue, mpmc_stress, ::testing::Combine(::testing::Values(1u, 2u, 4u), ::testing::Values(1u, 2u, 4u)));
+
+
+TEST(blocking_mpmc, many_producers_and_consumers)
+{
+	constexpr unsigned producers = 4, consumers = 3, per_producer = 30000, per_consumer = producers * per_producer / consumers;
+	aso::blocking<aso::mpmc_queue<uint32_t, 16>::stat> queue;
+	std::atomic<uint64_t> sum {0};
+	std::atomic<unsigned> errors {0};
+	std::vector<std::thread> threads;
+
+    static_assert(per_consumer * consumers == producers * per_producer, "the consumers share the items equally");
+    for (unsigned c = 0; c < consumers; c++)
+	threads.emplace_back([&] {
+		uint32_t v;
+
+	    for (unsigned n = 0; n < per_consumer; n++)
+		if (queue.pop_wait(v))
+		    sum += v;
+		else
+		    errors++;
+	});
+    for (unsigned p = 0; p < producers; p++)
+	threads.emplace_back([&] {
+	    for (uint32_t i = 1; i <= per_producer; i++)
+		if (!queue.push_wait(i))
+		    errors++;
+	});
+    for (auto& t: threads)
+	t.join();
+    EXPECT_EQ(errors, 0u);
+    EXPECT_EQ(sum, uint64_t(producers) * per_producer * (per_producer + 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(blocking_mpmc, wait_timeouts)
+{
+	aso::blocking<aso::mpmc_queue<int, 2>> queue;
+	int v;
+
+	TickType_t start = xTaskGetTickCount();
+
+    EXPECT_FALSE(queue.pop_wait(v, 3));
+    EXPECT_GE(xTaskGetTickCount() - start, 3u);
+
+    ASSERT_TRUE(queue.push(1));
+    ASSERT_TRUE(queue.push(2));
+    start = xTaskGetTickCount();
+    EXPECT_FALSE(queue.push_wait(3, 3));
+    EXPECT_GE(xTaskGetTickCount() - start, 3u);
+}
@@ -0,0 +1,209 @@
+/*!@file test_pool.cpp
+ *
+ * @brief Tests of the fixed-block memory pool & the monotonic arena: blocks alignment, exhausting,
+ *	  the std::pmr::memory_resource routing to the upstream
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <freertos/FreeRTOS.h>
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "astring.h"
+#include "host.hpp"
+#include "pool.hpp"
+
+
+namespace
+{
+
+bool aligned(const void* ptr, size_t align) { return reinterpret_cast<uintptr_t>(ptr) % align == 0; };
+
+///@brief upstream, counting the requests passed to it
+struct counting_resource: std::pmr::memory_resource
+{
+    void* do_allocate(size_t bytes, size_t alignment) override {
+	allocated++;
+	return std::pmr::new_delete_resource()->allocate(bytes, alignment); };
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override {
+	deallocated++;
+	std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment); };
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; };
+
+    int allocated = 0;
+    int deallocated = 0;
+}; /* struct counting_resource */
+
+///@brief take all the blocks of the pool: distinct, aligned & inside of the pool storage
+std::vector<void*> drain(aso::pool_resource& pool, size_t align)
+{
+	std::vector<void*> blocks;
+	std::set<void*> distinct;
+
+    while (void* ptr = pool.allocate_block())
+    {
+	EXPECT_TRUE(aligned(ptr, align)) << ptr;
+	EXPECT_TRUE(pool.owns(ptr));
+	blocks.push_back(ptr);
+	distinct.insert(ptr);
+    }
+    EXPECT_EQ(distinct.size(), blocks.size());
+    return blocks;
+}; /* drain() */
+
+}; /* namespace */
+
+
+TEST(pool, heap_storage_exhausts_and_reuses)
+{
+	aso::pool_resource pool(24, 5);
+
+    EXPECT_EQ(pool.capacity(), 5u);
+    EXPECT_EQ(pool.available(), 5u);
+    EXPECT_GE(pool.block_size(), 24u);
+
+	std::vector<void*> blocks = drain(pool, alignof(std::max_align_t));
+
+    ASSERT_EQ(blocks.size(), 5u);
+    EXPECT_EQ(pool.available(), 0u);
+    EXPECT_EQ(pool.allocate_block(), nullptr);
+    pool.free_block(blocks[2]);
+    EXPECT_EQ(pool.available(), 1u);
+    EXPECT_EQ(pool.allocate_block(), blocks[2]);
+    for (void* ptr: blocks)
+	pool.free_block(ptr);
+    EXPECT_EQ(pool.available(), 5u);
+}
+
+///@brief the blocks, smaller & less aligned than the free list node, are still aligned for the node
+TEST(pool, small_alignment_is_clamped_to_the_node)
+{
+	aso::pool_resource heap(1, 16, 1);
+	aso::pool_resource::stat<3, 16, 1> stat;
+	aso::pool<char, 16>::stat typed;
+
+    EXPECT_GE(heap.block_size(), sizeof(void*));
+    EXPECT_EQ(heap.block_size() % alignof(void*), 0u);
+    EXPECT_EQ(stat.block_size() % alignof(void*), 0u);
+    EXPECT_EQ(drain(heap, alignof(void*)).size(), 16u);
+    EXPECT_EQ(drain(stat, alignof(void*)).size(), 16u);
+    EXPECT_EQ(drain(typed, alignof(void*)).size(), 16u);
+}
+
+TEST(pool, over_aligned_blocks)
+{
+	aso::pool_resource heap(8, 4, 64);
+	aso::pool_resource::stat<8, 4, 64> stat;
+
+    EXPECT_EQ(heap.block_size(), 64u);
+    EXPECT_EQ(drain(heap, 64).size(), 4u);
+    EXPECT_EQ(drain(stat, 64).size(), 4u);
+}
+
+TEST(pool, typed_make_destroy)
+{
+	struct item { int a; double b; item(int a, double b): a(a), b(b) {}; };
+	aso::pool<item, 2>::stat pool;
+
+	item* x = pool.make(1, 2.5);
+	item* y = pool.make(2, 3.5);
+
+    ASSERT_NE(x, nullptr);
+    ASSERT_NE(y, nullptr);
+    EXPECT_EQ(x->a, 1);
+    EXPECT_EQ(y->b, 3.5);
+    EXPECT_EQ(pool.make(3, 0.0), nullptr);
+    pool.destroy(x);
+    EXPECT_EQ(pool.available(), 1u);
+    EXPECT_EQ(pool.make(4, 0.0), x);
+}
+
+TEST(pool, make_rejects_the_not_fitting_type)
+{
+	aso::pool_resource pool(8, 4, 8);
+	struct big { char data[32]; };
+	struct alignas(32) over { int v; };
+
+    EXPECT_EQ(pool.make<big>(), nullptr);
+    EXPECT_EQ(pool.make<over>(), nullptr);
+    EXPECT_EQ(pool.available(), 4u);
+}
+
+TEST(pool, pmr_routes_to_the_upstream)
+{
+	counting_resource upstream;
+	aso::pool_resource pool(32, 2, alignof(std::max_align_t), &upstream);
+
+	void* a = pool.allocate(32);
+	void* b = pool.allocate(16);
+
+    EXPECT_TRUE(pool.owns(a));
+    EXPECT_TRUE(pool.owns(b));
+    EXPECT_EQ(upstream.allocated, 0);
+
+	void* exhausted = pool.allocate(8);
+	void* large = pool.allocate(64);
+
+    EXPECT_FALSE(pool.owns(exhausted));
+    EXPECT_FALSE(pool.owns(large));
+    EXPECT_EQ(upstream.allocated, 2);
+
+    pool.deallocate(a, 32);
+    pool.deallocate(exhausted, 8);
+    pool.deallocate(large, 64);
+    pool.deallocate(b, 16);
+    EXPECT_EQ(upstream.deallocated, 2);
+    EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(pool, pmr_list_nodes)
+{
+	aso::pool<std::array<char, 48>, 8>::stat pool;
+	std::pmr::list<int> list(&pool);
+
+    for (int i = 0; i < 8; i++)
+	list.push_back(i);
+    EXPECT_EQ(pool.available(), 0u);
+    list.clear();
+    EXPECT_EQ(pool.available(), 8u);
+}
+
+TEST(pool, callable_from_isr)
+{
+	aso::pool_resource::stat<16, 2> pool;
+	void* ptr;
+
+    {
+	    host::isr_scope isr;
+
+	ptr = pool.allocate_block();
+	EXPECT_NE(ptr, nullptr);
+	pool.free_block(ptr);
+    }
+    EXPECT_EQ(pool.available(), 2u);
+}
+
+
+TEST(arena, makestor_from_the_arena)
+{
+	const char* argv[] = {"first argument, longer than the small string buffer", "second", "third argument, also rather long"};
+	aso::arena<1024> arena(std::pmr::null_memory_resource());
+
+	auto args = astr::makestor<std::pmr::vector<std::pmr::string>>(std::size(argv), argv, &arena);
+
+    ASSERT_EQ(args.size(), 3u);
+    EXPECT_EQ(args[0], argv[0]);
+    EXPECT_EQ(args[2], argv[2]);
+    EXPECT_EQ(args.get_allocator().resource(), &arena);
+    EXPECT_EQ(args[0].get_allocator().resource(), &arena);
+}
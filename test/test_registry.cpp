@@ -0,0 +1,258 @@
+/*!@file test_registry.cpp
+ *
+ * @brief Tests of the event::registry on the local event loop: the dispatch through the shared trampoline,
+ *	  the handlers created at runtime, the tokens & the slots reuse, the registration errors
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "event_ctrl.hpp"
+#include "event_registry.hpp"
+
+
+ESP_EVENT_DEFINE_BASE(REGISTRY_TEST_EVENT);
+
+namespace
+{
+
+///@brief the handler counts the calls & stores the last payload
+struct counting: event::handler::base
+{
+    using base::base;
+    void instance_handler(void* a, esp_event_base_t, int32_t id, void* data) override {
+	calls++;
+	last_id = id;
+	last_arg = a;
+	if (data)
+	    payload = *static_cast<int*>(data); };
+
+    int calls = 0;
+    int32_t last_id = -1;
+    void* last_arg = nullptr;
+    int payload = 0;
+}; /* struct counting */
+
+///@brief the event loop w/o the task: dispatched by the test itself
+class registry_loop: public ::testing::Test
+{
+protected:
+    void SetUp() override {
+	    esp_event_loop_args_t args = {16, nullptr, 0, 0, 0};
+
+	ASSERT_EQ(esp_event_loop_create(&args, &loop), ESP_OK); };
+    void TearDown() override { esp_event_loop_delete(loop); };
+
+    void post(int32_t id, int payload = 0) {
+	ASSERT_EQ(esp_event_post_to(loop, REGISTRY_TEST_EVENT, id, &payload, sizeof(payload), 0), ESP_OK);
+	esp_event_loop_run(loop, 0); };
+
+    esp_event_loop_handle_t loop;
+}; /* class registry_loop */
+
+}; /* namespace */
+
+
+TEST_F(registry_loop, dispatch_to_the_handler_object)
+{
+	event::registry<4> reg;
+	int tag = 0;
+	counting h(REGISTRY_TEST_EVENT, 1, &tag);
+	auto t = reg.enroll_to(loop, h);
+
+    ASSERT_TRUE(t);
+    EXPECT_EQ(t.error(), ESP_OK);
+    EXPECT_EQ(reg.size(), 1u);
+    post(1, 42);
+    post(2);
+    EXPECT_EQ(h.calls, 1);
+    EXPECT_EQ(h.last_id, 1);
+    EXPECT_EQ(h.payload, 42);
+    EXPECT_EQ(h.last_arg, &tag);
+}; /* dispatch_to_the_handler_object */
+
+TEST_F(registry_loop, explicit_base_and_event)
+{
+	event::registry<4> reg;
+	counting h(REGISTRY_TEST_EVENT, 1);
+	auto t = reg.enroll_to(loop, h, REGISTRY_TEST_EVENT, ESP_EVENT_ANY_ID);
+
+    post(1);
+    post(7);
+    EXPECT_EQ(h.calls, 2);
+    EXPECT_EQ(h.last_id, 7);
+}; /* explicit_base_and_event */
+
+TEST_F(registry_loop, loop_base_uses_own_loop)
+{
+	struct own: event::handler::loop_base
+	{
+	    using loop_base::loop_base;
+	    void instance_handler(void*, esp_event_base_t, int32_t, void*) override { calls++; };
+	    int calls = 0;
+	};
+	event::registry<2> reg;
+	own h(loop, REGISTRY_TEST_EVENT, 3);
+	auto t = reg.enroll_to(h);
+
+    ASSERT_TRUE(t);
+    post(3);
+    EXPECT_EQ(h.calls, 1);
+}; /* loop_base_uses_own_loop */
+
+TEST_F(registry_loop, runtime_handlers_are_dispatched_separately)
+{
+	event::registry<8> reg;
+	std::vector<std::unique_ptr<counting>> handlers;
+	std::vector<event::registry<8>::token> tokens;
+
+    for (int i = 0; i < 8; i++)
+    {
+	handlers.push_back(std::make_unique<counting>(REGISTRY_TEST_EVENT, i));
+	tokens.push_back(reg.enroll_to(loop, *handlers.back()));
+	ASSERT_TRUE(tokens.back());
+    }
+    EXPECT_EQ(reg.size(), 8u);
+    for (int i = 0; i < 8; i++)
+	for (int n = 0; n <= i; n++)
+	    post(i, i);
+    for (int i = 0; i < 8; i++)
+    {
+	EXPECT_EQ(handlers[i]->calls, i + 1) << "handler " << i;
+	EXPECT_EQ(handlers[i]->payload, i);
+    }
+}; /* runtime_handlers_are_dispatched_separately */
+
+TEST_F(registry_loop, token_destroy_unregisters)
+{
+	event::registry<4> reg;
+	counting h(REGISTRY_TEST_EVENT, 1);
+
+    {
+	auto t = reg.enroll_to(loop, h);
+	post(1);
+    }
+    EXPECT_EQ(reg.size(), 0u);
+    post(1);
+    EXPECT_EQ(h.calls, 1);
+}; /* token_destroy_unregisters */
+
+TEST_F(registry_loop, explicit_unreg)
+{
+	event::registry<4> reg;
+	counting h(REGISTRY_TEST_EVENT, 1);
+	auto t = reg.enroll_to(loop, h);
+
+    EXPECT_EQ(t.unreg(), ESP_OK);
+    EXPECT_FALSE(t);
+    EXPECT_EQ(t.unreg(), ESP_ERR_INVALID_STATE);
+    EXPECT_EQ(reg.size(), 0u);
+    post(1);
+    EXPECT_EQ(h.calls, 0);
+}; /* explicit_unreg */
+
+TEST_F(registry_loop, token_move)
+{
+	event::registry<4> reg;
+	counting a(REGISTRY_TEST_EVENT, 1), b(REGISTRY_TEST_EVENT, 2);
+	auto ta = reg.enroll_to(loop, a);
+	auto tb = reg.enroll_to(loop, b);
+	event::registry<4>::token moved(std::move(ta));
+
+    EXPECT_FALSE(ta);
+    ASSERT_TRUE(moved);
+    post(1);
+    EXPECT_EQ(a.calls, 1);
+
+    // the move assignment unregisters the previous registration of the target
+    moved = std::move(tb);
+    EXPECT_EQ(reg.size(), 1u);
+    post(1);
+    post(2);
+    EXPECT_EQ(a.calls, 1);
+    EXPECT_EQ(b.calls, 1);
+}; /* token_move */
+
+TEST_F(registry_loop, release_keeps_registration_up_to_registry_destroy)
+{
+	counting h(REGISTRY_TEST_EVENT, 1);
+
+    {
+	    event::registry<4> reg;
+
+	reg.enroll_to(loop, h).release();
+	EXPECT_EQ(reg.size(), 1u);
+	post(1);
+	EXPECT_EQ(h.calls, 1);
+    }
+    post(1);
+    EXPECT_EQ(h.calls, 1);
+}; /* release_keeps_registration_up_to_registry_destroy */
+
+TEST_F(registry_loop, capacity_exhausted_and_slot_reused)
+{
+	event::registry<2> reg;
+	counting a(REGISTRY_TEST_EVENT, 1), b(REGISTRY_TEST_EVENT, 2), c(REGISTRY_TEST_EVENT, 3);
+	auto ta = reg.enroll_to(loop, a);
+	auto tb = reg.enroll_to(loop, b);
+	auto tc = reg.enroll_to(loop, c);
+
+    EXPECT_EQ(reg.capacity(), 2u);
+    EXPECT_FALSE(tc);
+    EXPECT_EQ(tc.error(), ESP_ERR_NO_MEM);
+    EXPECT_EQ(reg.size(), 2u);
+
+    ta.unreg();
+    tc = reg.enroll_to(loop, c);
+    ASSERT_TRUE(tc);
+    post(1);
+    post(3);
+    EXPECT_EQ(a.calls, 0);
+    EXPECT_EQ(c.calls, 1);
+}; /* capacity_exhausted_and_slot_reused */
+
+TEST(registry, registration_error_frees_the_slot)
+{
+	event::registry<1> reg;
+	counting h(REGISTRY_TEST_EVENT, 1);
+
+    // the default loop was not created
+    auto t = reg.enroll(h);
+    EXPECT_FALSE(t);
+    EXPECT_EQ(t.error(), ESP_ERR_INVALID_STATE);
+    EXPECT_EQ(reg.size(), 0u);
+}; /* registration_error_frees_the_slot */
+
+TEST_F(registry_loop, automatic_registers_on_request)
+{
+	event::registry<2> reg;
+	counting h(REGISTRY_TEST_EVENT, 1);
+
+    // the automatic registers to the default loop, as the ctrl::automatic
+    ASSERT_EQ(esp_event_loop_create_default(), ESP_OK);
+    {
+	    event::registry<2>::automatic lazy(reg, h);
+
+	EXPECT_EQ(reg.size(), 0u);
+	EXPECT_EQ(lazy.enroll(), ESP_OK);
+	EXPECT_EQ(reg.size(), 1u);
+	EXPECT_EQ(lazy.unreg(), ESP_OK);
+	EXPECT_EQ(reg.size(), 0u);
+    }
+    {
+	    event::registry<2>::automatic eager(reg, h, true);
+
+	EXPECT_EQ(reg.size(), 1u);
+    }
+    EXPECT_EQ(reg.size(), 0u);
+    esp_event_loop_delete_default();
+}; /* automatic_registers_on_request */
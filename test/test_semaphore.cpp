@@ -0,0 +1,295 @@
+/*!@file test_semaphore.cpp
+ *
+ * @brief Tests of the asemaphore family
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "asemaphore"
+#include "host.hpp"
+
+
+//--[ asemaphore::notify ]---------------------------------------------------------------------------------------------
+
+namespace
+{
+
+///@brief the tests run in the fresh thread each: the notification value of the task is not shared between tests
+template <typename Body>
+void in_task(Body&& body)
+{
+    std::thread(std::forward<Body>(body)).join();
+}; /* in_task() */
+
+}; /* namespace */
+
+
+TEST(notify, bound_to_the_creating_task)
+{
+    in_task([] {
+	    asemaphore::notify sem;
+
+	EXPECT_EQ(sem.task(), xTaskGetCurrentTaskHandle());
+	EXPECT_EQ(sem.Take(0), pdFALSE);
+	EXPECT_EQ(sem.Give(), pdPASS);
+	EXPECT_EQ(sem.Take(0), pdTRUE);
+	EXPECT_EQ(sem.Take(0), pdFALSE);
+    });
+}
+
+TEST(notify, binary_and_counting)
+{
+    in_task([] {
+	    asemaphore::notify bin;
+
+	bin.Give();
+	bin.Give();
+	EXPECT_EQ(bin.Take(0), pdTRUE);
+	EXPECT_EQ(bin.Take(0), pdFALSE);
+    });
+    in_task([] {
+	    asemaphore::notify cnt(true);
+
+	cnt.Give();
+	cnt.Give();
+	EXPECT_EQ(cnt.count(), 2u);
+	EXPECT_EQ(cnt.Take(0), pdTRUE);
+	EXPECT_EQ(cnt.Take(0), pdTRUE);
+	EXPECT_EQ(cnt.Take(0), pdFALSE);
+    });
+}
+
+TEST(notify, give_before_bind_is_latched)
+{
+	asemaphore::notify sem(nullptr);
+
+    EXPECT_FALSE(sem.created());
+    EXPECT_EQ(sem.Give(), pdPASS);
+    EXPECT_EQ(sem.count(), 1u);
+    in_task([&] {
+	// the first Take binds the task & gets the latched give
+	EXPECT_EQ(sem.Take(0), pdTRUE);
+	EXPECT_EQ(sem.task(), xTaskGetCurrentTaskHandle());
+	EXPECT_EQ(sem.Take(0), pdFALSE);
+    });
+}
+
+TEST(notify, counting_latch_is_delivered_on_bind)
+{
+	asemaphore::notify sem(nullptr, true);
+
+    sem.Give();
+    sem.Give();
+    sem.Give();
+    EXPECT_EQ(sem.count(), 3u);
+    in_task([&] {
+	sem.bind();
+	EXPECT_EQ(sem.count(), 3u);
+	for (int i = 0; i < 3; i++)
+	    EXPECT_EQ(sem.Take(0), pdTRUE);
+	EXPECT_EQ(sem.Take(0), pdFALSE);
+    });
+}
+
+TEST(notify, isr_give_before_bind_is_latched)
+{
+	asemaphore::notify sem(nullptr);
+	BaseType_t woken = pdFALSE;
+
+    {
+	host::isr_scope isr;
+	EXPECT_EQ(sem.GiveFromISR(&woken), pdPASS);
+    }
+    in_task([&] { EXPECT_EQ(sem.Take(0), pdTRUE); });
+}
+
+TEST(notify, give_wakes_the_waiter)
+{
+	asemaphore::notify sem(nullptr);
+	std::atomic<bool> bound {false};
+
+	std::thread waiter([&] {
+	    sem.bind();
+	    bound = true;
+	    EXPECT_EQ(sem.Take(pdMS_TO_TICKS(5000)), pdTRUE);
+	});
+
+    while (!bound)
+	std::this_thread::yield();
+    sem.Give();
+    waiter.join();
+}
+
+///@brief the give racing with the binding Take is never lost
+TEST(notify, give_racing_with_bind)
+{
+    for (int i = 0; i < 2000; i++)
+    {
+	    asemaphore::notify sem(nullptr);
+	    std::thread giver([&] { sem.Give(); });
+
+	in_task([&] { EXPECT_EQ(sem.Take(pdMS_TO_TICKS(2000)), pdTRUE) << "iteration " << i; });
+	giver.join();
+	if (HasFailure())
+	    break;
+    }
+}
+
+///@brief the counting gives of the several givers racing with bind() are all delivered
+TEST(notify, counting_gives_racing_with_bind)
+{
+	constexpr int givers = 4, gives = 3;
+
+    for (int i = 0; i < 500; i++)
+    {
+	    asemaphore::notify sem(nullptr, true);
+	    std::atomic<bool> go {false};
+	    std::vector<std::thread> threads;
+
+	for (int g = 0; g < givers; g++)
+	    threads.emplace_back([&] {
+		while (!go)
+		    std::this_thread::yield();
+		for (int n = 0; n < gives; n++)
+		    sem.Give();
+	    });
+	in_task([&] {
+		int taken = 0;
+
+	    go = true;
+	    sem.bind();
+	    while (taken < givers * gives && sem.Take(pdMS_TO_TICKS(2000)) == pdTRUE)
+		taken++;
+	    EXPECT_EQ(taken, givers * gives) << "iteration " << i;
+	    EXPECT_EQ(sem.Take(0), pdFALSE) << "iteration " << i;
+	});
+	for (auto& t: threads)
+	    t.join();
+	if (HasFailure())
+	    break;
+    }
+}
+
+
+//--[ asemaphore: batches, ISR variants, initializing ]----------------------------------------------------------------
+
+TEST(asemaphore, batched_take_is_all_or_nothing)
+{
+	asemaphore sem(5, 2);
+	TickType_t start = xTaskGetTickCount();
+
+    // 2 of 3 are available: the taken are returned back after the timeout
+    EXPECT_EQ(sem.Take(3, 2), pdFALSE);
+    EXPECT_GE(xTaskGetTickCount() - start, 2u);
+    EXPECT_EQ(sem.count(), 2u);
+    EXPECT_EQ(sem.Take(3, 0), pdFALSE);
+    EXPECT_EQ(sem.count(), 2u);
+
+    EXPECT_EQ(sem.Take(2, 0), pdTRUE);
+    EXPECT_EQ(sem.count(), 0u);
+    EXPECT_EQ(sem.Take(0, 0), pdTRUE);
+}
+
+TEST(asemaphore, batched_take_waits_for_the_rest)
+{
+	asemaphore sem(5, 1);
+	std::thread giver([&] {
+	    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	    sem.Give(2);
+	});
+
+    EXPECT_EQ(sem.Take(3, pdMS_TO_TICKS(2000)), pdTRUE);
+    EXPECT_EQ(sem.count(), 0u);
+    giver.join();
+}
+
+TEST(asemaphore, batched_give_saturates_at_max_count)
+{
+	asemaphore sem(4, 1);
+
+    EXPECT_EQ(sem.Give(2), pdPASS);
+    EXPECT_EQ(sem.count(), 3u);
+    EXPECT_EQ(sem.Give(3), pdFAIL);
+    EXPECT_EQ(sem.count(), 4u);
+    EXPECT_EQ(sem.Give(0), pdPASS);
+    EXPECT_EQ(sem.Take(4, 0), pdTRUE);
+}
+
+TEST(asemaphore, isr_take_and_give)
+{
+	asemaphore sem(3, 0);
+	BaseType_t woken = pdFALSE;
+	host::isr_scope isr;
+
+    EXPECT_EQ(sem.TakeFromISR(&woken), pdFAIL);
+    EXPECT_EQ(sem.GiveFromISR(&woken), pdPASS);
+    EXPECT_EQ(woken, pdTRUE);
+
+    woken = pdFALSE;
+    EXPECT_EQ(sem.GiveFromISR(3, &woken), pdFAIL);
+    EXPECT_EQ(woken, pdTRUE);
+    EXPECT_EQ(sem.count(), 3u);
+
+    // the woken may be omitted
+    EXPECT_EQ(sem.TakeFromISR(nullptr), pdPASS);
+    EXPECT_EQ(sem.GiveFromISR(1, nullptr), pdPASS);
+    EXPECT_EQ(sem.count(), 3u);
+}
+
+TEST(asemaphore, isr_does_not_initialize)
+{
+	asemaphore sem;
+	BaseType_t woken = pdFALSE;
+
+    {
+	host::isr_scope isr;
+
+	EXPECT_EQ(sem.GiveFromISR(&woken), pdFAIL);
+	EXPECT_EQ(sem.GiveFromISR(2, &woken), pdFAIL);
+	EXPECT_EQ(sem.TakeFromISR(&woken), pdFAIL);
+    }
+    EXPECT_FALSE(sem.created());
+    EXPECT_EQ(woken, pdFALSE);
+}
+
+#if CONFIG_ASO_UTILS_SEMAPHORE_STRICT_INIT
+
+TEST(asemaphore, strict_init_asserts_the_not_created)
+{
+    EXPECT_DEATH({ asemaphore sem; sem.Give(); }, "");
+    EXPECT_DEATH({ asemaphore sem; sem.Take(0); }, "");
+    EXPECT_DEATH({ asemaphore sem; sem.Take(2, 0); }, "");
+    EXPECT_DEATH({ asemaphore sem; sem.Give(2); }, "");
+
+	asemaphore sem(false);
+
+    EXPECT_EQ(sem.Give(), pdTRUE);
+    EXPECT_EQ(sem.Take(0), pdTRUE);
+}
+
+#else
+
+TEST(asemaphore, lazy_init_as_binary)
+{
+	asemaphore sem;
+
+    EXPECT_FALSE(sem.created());
+    EXPECT_EQ(sem.Give(), pdTRUE);
+    EXPECT_TRUE(sem.created());
+    EXPECT_EQ(sem.Give(), pdFALSE);
+    EXPECT_EQ(sem.Take(0), pdTRUE);
+}
+
+#endif	// CONFIG_ASO_UTILS_SEMAPHORE_STRICT_INIT
@@ -0,0 +1,227 @@
+/*!@file test_semstat.cpp
+ *
+ * @brief Tests of the per-semaphore statistics (CONFIG_ASO_UTILS_SEMAPHORE_STATS): the take, contended take,
+ *	  timeout & give counters, the registry snapshot, dump & reset, the unregistering on the destroy
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "asemaphore"
+#include "host.hpp"
+#include "semstat.hpp"
+
+
+using namespace std::chrono_literals;
+
+namespace
+{
+
+///@brief the record of the semaphore in the registry snapshot
+bool find(const void* owner, aso::semstat::record& rec)
+{
+	std::vector<aso::semstat::record> all(aso::semstat::snapshot(nullptr, 0));
+
+    all.resize(aso::semstat::snapshot(all.data(), all.size()));
+    for (auto& r: all)
+	if (r.owner == owner)
+	{
+	    rec = r;
+	    return true;
+	}; /* if r.owner == owner */
+    return false;
+}; /* find() */
+
+///@brief the text of the log, for the dump test
+std::string logged;
+
+int capture(const char* fmt, va_list args)
+{
+	char line[256];
+	int len = std::vsnprintf(line, sizeof(line), fmt, args);
+
+    logged += line;
+    logged += '\n';
+    return len;
+}; /* capture() */
+
+}; /* namespace */
+
+
+TEST(semstat, take_and_give)
+{
+	asemaphore sem(false);
+
+    EXPECT_EQ(sem.Give(), pdTRUE);
+    EXPECT_EQ(sem.Give(), pdFALSE);		// the binary semaphore is full: not counted
+    EXPECT_EQ(sem.Take(), pdTRUE);
+
+	aso::semstat::record rec = sem.stats().snapshot();
+
+    EXPECT_EQ(rec.owner, &sem);
+    EXPECT_EQ(rec.takes, 1u);
+    EXPECT_EQ(rec.contended, 0u);
+    EXPECT_EQ(rec.timeouts, 0u);
+    EXPECT_EQ(rec.gives, 1u);
+    EXPECT_EQ(rec.wait_max, 0u);
+    EXPECT_EQ(rec.wait_total, 0u);
+}
+
+TEST(semstat, contended_take)
+{
+	asemaphore sem(false);
+	std::thread giver([&] {
+	    // the margin for the loaded host: the Take is blocked before the give
+	    std::this_thread::sleep_for(100ms);
+	    sem.Give();
+	});
+
+    EXPECT_EQ(sem.Take(), pdTRUE);
+    giver.join();
+
+	aso::semstat::record rec = sem.stats().snapshot();
+
+    EXPECT_EQ(rec.takes, 1u);
+    EXPECT_EQ(rec.contended, 1u);
+    EXPECT_EQ(rec.timeouts, 0u);
+    EXPECT_EQ(rec.gives, 1u);
+    EXPECT_GE(rec.wait_max, 20000u);
+    EXPECT_EQ(rec.wait_total, rec.wait_max);
+}
+
+TEST(semstat, timeouts)
+{
+	asemaphore sem(false);
+
+    // w/o waiting: the timeout, not contended
+    EXPECT_EQ(sem.Take(0), pdFALSE);
+	aso::semstat::record rec = sem.stats().snapshot();
+
+    EXPECT_EQ(rec.timeouts, 1u);
+    EXPECT_EQ(rec.contended, 0u);
+
+    // with waiting: the timeout of the contended take, the wait time is counted
+    EXPECT_EQ(sem.Take(2), pdFALSE);
+    rec = sem.stats().snapshot();
+    EXPECT_EQ(rec.takes, 0u);
+    EXPECT_EQ(rec.timeouts, 2u);
+    EXPECT_EQ(rec.contended, 1u);
+    // the wait of the 2 ticks is 1 tick period at least: it starts at any phase of the current tick
+    EXPECT_GE(rec.wait_max, portTICK_PERIOD_MS * 1000 - 1000);
+}
+
+TEST(semstat, batched_take_and_give_are_counted_alike)
+{
+	asemaphore sem(4, 0);
+
+    // the gives over the max count are not counted
+    EXPECT_EQ(sem.Give(6), pdFAIL);
+    EXPECT_EQ(sem.count(), 4u);
+    EXPECT_EQ(sem.stats().snapshot().gives, 4u);
+
+    EXPECT_EQ(sem.Take(3, 0), pdTRUE);
+	aso::semstat::record rec = sem.stats().snapshot();
+
+    EXPECT_EQ(rec.takes, 3u);
+    EXPECT_EQ(rec.contended, 0u);
+
+    // the failed batch is the one timeout, the rolled back units are neither takes nor gives
+    EXPECT_EQ(sem.Take(2, 2), pdFALSE);
+    EXPECT_EQ(sem.count(), 1u);
+    rec = sem.stats().snapshot();
+    EXPECT_EQ(rec.takes, 3u);
+    EXPECT_EQ(rec.timeouts, 1u);
+    EXPECT_EQ(rec.contended, 1u);
+    EXPECT_EQ(rec.gives, 4u);
+}
+
+TEST(semstat, isr_take_and_give)
+{
+	asemaphore sem(3, 0);
+	BaseType_t woken = pdFALSE;
+
+    {
+	host::isr_scope isr;
+
+	EXPECT_EQ(sem.GiveFromISR(&woken), pdTRUE);
+	EXPECT_EQ(sem.GiveFromISR(4, &woken), pdFAIL);
+	EXPECT_EQ(sem.TakeFromISR(&woken), pdTRUE);
+    }
+
+	aso::semstat::record rec = sem.stats().snapshot();
+
+    EXPECT_EQ(rec.gives, 3u);
+    EXPECT_EQ(rec.takes, 1u);
+}
+
+TEST(semstat, registry_snapshot_and_reset)
+{
+	asemaphore a(true), b(false);
+	aso::semstat::record rec;
+
+    a.Take();
+    b.Take(0);
+    ASSERT_TRUE(find(&a, rec));
+    EXPECT_EQ(rec.takes, 1u);
+    EXPECT_EQ(rec.gives, 1u);
+    ASSERT_TRUE(find(&b, rec));
+    EXPECT_EQ(rec.timeouts, 1u);
+
+    // the partial snapshot returns the total count, fills the requested portion only
+	size_t total = aso::semstat::snapshot(nullptr, 0);
+	aso::semstat::record one {};
+
+    EXPECT_GE(total, 2u);
+    EXPECT_EQ(aso::semstat::snapshot(&one, 1, total - 1), total);
+    EXPECT_NE(one.owner, nullptr);
+
+    aso::semstat::reset();
+    ASSERT_TRUE(find(&a, rec));
+    EXPECT_EQ(rec.takes + rec.gives + rec.timeouts + rec.contended, 0u);
+    ASSERT_TRUE(find(&b, rec));
+    EXPECT_EQ(rec.takes + rec.gives + rec.timeouts + rec.contended, 0u);
+}
+
+TEST(semstat, dump_prints_every_semaphore)
+{
+	asemaphore sem(true);
+	char owner[32];
+
+    std::snprintf(owner, sizeof(owner), "%10p", static_cast<const void*>(&sem));
+    logged.clear();
+
+	vprintf_like_t prev = esp_log_set_vprintf(capture);
+
+    aso::semstat::dump();
+    esp_log_set_vprintf(prev);
+    EXPECT_NE(logged.find("contended"), std::string::npos);
+    EXPECT_NE(logged.find(owner), std::string::npos) << logged;
+}
+
+TEST(semstat, unregistered_on_destroy)
+{
+	size_t before = aso::semstat::snapshot(nullptr, 0);
+	auto sem = std::make_unique<asemaphore>(true);
+	const void* owner = sem.get();
+	aso::semstat::record rec;
+
+    EXPECT_EQ(aso::semstat::snapshot(nullptr, 0), before + 1);
+    EXPECT_TRUE(find(owner, rec));
+    sem.reset();
+    EXPECT_EQ(aso::semstat::snapshot(nullptr, 0), before);
+    EXPECT_FALSE(find(owner, rec));
+}
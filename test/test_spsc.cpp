@@ -0,0 +1,139 @@
+/*!@file test_spsc.cpp
+ *
+ * @brief Tests of the lock-free SPSC ring & of it's blocking adapter
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <memory>
+#include <thread>
+
+#include "asemaphore"
+#include "blocking.hpp"
+#include "spsc_ring.hpp"
+
+
+TEST(spsc_ring, fifo_full_and_empty)
+{
+	aso::spsc_ring<int, 4> ring;
+	int v;
+
+    EXPECT_EQ(ring.capacity(), 4u);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_FALSE(ring.pop(v));
+    for (int i = 0; i < 4; i++)
+	EXPECT_TRUE(ring.push(i));
+    EXPECT_TRUE(ring.full());
+    EXPECT_FALSE(ring.push(4));
+    EXPECT_EQ(ring.size(), 4u);
+    for (int i = 0; i < 4; i++)
+    {
+	ASSERT_TRUE(ring.pop(v));
+	EXPECT_EQ(v, i);
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(spsc_ring, wraps_around)
+{
+	aso::spsc_ring<unsigned, 8>::stat ring;
+	unsigned v;
+
+    for (unsigned i = 0; i < 1000; i++)
+    {
+	ASSERT_TRUE(ring.push(i));
+	ASSERT_TRUE(ring.push(i + 1));
+	ASSERT_TRUE(ring.pop(v));
+	EXPECT_EQ(v, i);
+	ASSERT_TRUE(ring.pop(v));
+	EXPECT_EQ(v, i + 1);
+    }
+}
+
+TEST(spsc_ring, move_only_items)
+{
+	aso::spsc_ring<std::unique_ptr<int>, 2> ring;
+	auto item = std::make_unique<int>(7);
+	std::unique_ptr<int> out;
+
+    ASSERT_TRUE(ring.push(std::move(item)));
+    EXPECT_FALSE(item);
+    ASSERT_TRUE(ring.push(std::make_unique<int>(8)));
+
+	auto rejected = std::make_unique<int>(9);
+
+    // the item is not touched if the ring is full
+    EXPECT_FALSE(ring.push(std::move(rejected)));
+    EXPECT_TRUE(rejected);
+    ASSERT_TRUE(ring.pop(out));
+    EXPECT_EQ(*out, 7);
+}
+
+TEST(spsc_ring, producer_and_consumer_threads)
+{
+	constexpr unsigned count = 1000000;
+	aso::spsc_ring<unsigned, 64> ring;
+	unsigned errors = 0;
+
+	std::thread consumer([&] {
+	    for (unsigned expected = 0, v; expected < count;)
+		if (ring.pop(v))
+		    errors += (v != expected++);
+		else
+		    std::this_thread::yield();
+	});
+
+    for (unsigned i = 0; i < count;)
+	if (ring.push(i))
+	    i++;
+	else
+	    std::this_thread::yield();
+    consumer.join();
+    EXPECT_EQ(errors, 0u);
+}
+
+
+TEST(blocking_spsc, waits_while_empty_and_full)
+{
+	constexpr unsigned count = 100000;
+	aso::blocking<aso::spsc_ring<unsigned, 16>> ring;
+	unsigned errors = 0;
+
+	std::thread consumer([&] {
+	    for (unsigned expected = 0, v; expected < count; expected++)
+	    {
+		if (!ring.pop_wait(v))
+		    errors++;
+		errors += (v != expected);
+	    }
+	});
+
+    for (unsigned i = 0; i < count; i++)
+	ASSERT_TRUE(ring.push_wait(i));
+    consumer.join();
+    EXPECT_EQ(errors, 0u);
+}
+
+TEST(blocking_spsc, wait_timeouts)
+{
+	aso::blocking<aso::spsc_ring<int, 2>> ring;
+	int v;
+
+	TickType_t start = xTaskGetTickCount();
+
+    EXPECT_FALSE(ring.pop_wait(v, 3));
+    EXPECT_GE(xTaskGetTickCount() - start, 3u);
+
+    ASSERT_TRUE(ring.push(1));
+    ASSERT_TRUE(ring.push(2));
+    start = xTaskGetTickCount();
+    EXPECT_FALSE(ring.push_wait(3, 3));
+    EXPECT_GE(xTaskGetTickCount() - start, 3u);
+}
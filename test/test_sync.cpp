@@ -0,0 +1,101 @@
+/*!@file test_sync.cpp
+ *
+ * @brief Tests of the event synchronizers: event::sync & the event::sync_group on the event loop
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <chrono>
+#include <type_traits>
+
+#include "asemaphore"
+#include "event_ctrl.hpp"
+#include "sync.hpp"
+
+
+using namespace std::chrono_literals;
+
+ESP_EVENT_DEFINE_BASE(SYNC_TEST_EVENT);
+
+namespace
+{
+
+enum { wifi_connected, ip_acquired, sntp_synced };
+
+///@brief the event loop with the own task, for the test lifetime
+class sync_loop: public ::testing::Test
+{
+protected:
+    void SetUp() override {
+	    esp_event_loop_args_t args = {8, "sync_loop", 5, 4096, tskNO_AFFINITY};
+
+	ASSERT_EQ(esp_event_loop_create(&args, &loop), ESP_OK); };
+    void TearDown() override { esp_event_loop_delete(loop); };
+
+    void post(int32_t ev) { ASSERT_EQ(esp_event_post_to(loop, SYNC_TEST_EVENT, ev, nullptr, 0, portMAX_DELAY), ESP_OK); };
+
+    esp_event_loop_handle_t loop;
+}; /* class sync_loop */
+
+event::sync connected(SYNC_TEST_EVENT, wifi_connected);
+
+}; /* namespace */
+
+
+TEST_F(sync_loop, sync_waits_for_the_event)
+{
+    ASSERT_EQ(event::ctrl<connected>::enroll_to(loop), ESP_OK);
+    EXPECT_EQ(connected.Take(0), pdFALSE);
+    post(wifi_connected);
+    EXPECT_EQ(connected.Take(1s), pdTRUE);
+    event::ctrl<connected>::unreg_from(loop);
+}
+
+template <typename Group>
+class sync_group: public sync_loop {};
+
+using group_types = ::testing::Types<event::sync_group, event::sync_group::stat>;
+TYPED_TEST_SUITE(sync_group, group_types);
+
+TYPED_TEST(sync_group, wait_all_and_any)
+{
+	TypeParam group;
+	event::sync_group::member wifi(group, wifi_connected, SYNC_TEST_EVENT, wifi_connected);
+	event::sync_group::member ip(group, ip_acquired, SYNC_TEST_EVENT, ip_acquired);
+	event::sync_group::member sntp(group, std::integral_constant<unsigned, sntp_synced>(), SYNC_TEST_EVENT, sntp_synced);
+	const EventBits_t all = wifi.bits | ip.bits | sntp.bits;
+
+    ASSERT_TRUE(group.created());
+    for (event::sync_group::member* m: {&wifi, &ip, &sntp})
+	ASSERT_EQ(event::sync_group::enroll_to(this->loop, *m), ESP_OK);
+
+    this->post(ip_acquired);
+    EXPECT_EQ(group.wait_any(all, pdMS_TO_TICKS(1000), false), ip.bits);
+    EXPECT_FALSE(group.wait_all(all, pdMS_TO_TICKS(20)));
+    this->post(wifi_connected);
+    this->post(sntp_synced);
+    EXPECT_TRUE(group.wait_all(all, pdMS_TO_TICKS(1000)));
+    // auto-clear
+    EXPECT_EQ(group.bits() & all, 0u);
+    EXPECT_EQ(group.wait_any(all, 0), 0u);
+
+    for (event::sync_group::member* m: {&wifi, &ip, &sntp})
+	event::sync_group::unreg_from(this->loop, *m);
+}
+
+TEST(sync_group_member, bit_out_of_the_group_asserts)
+{
+	event::sync_group group;
+
+    EXPECT_EQ(event::sync_group::member(group, event::sync_group::max_bits - 1, SYNC_TEST_EVENT, 0).bits, EventBits_t(1) << 23);
+    EXPECT_DEATH(event::sync_group::member(group, event::sync_group::max_bits, SYNC_TEST_EVENT, 0), "max_bits");
+    EXPECT_DEATH(event::sync_group::member(group, 31, SYNC_TEST_EVENT, 0), "max_bits");
+}
@@ -0,0 +1,174 @@
+/*!@file test_table.cpp
+ *
+ * @brief Tests of the event::table static dispatch on the local event loop: the fan out by the event base & id,
+ *	  the ESP_EVENT_ANY_ID handlers, the unregistering & the repeated registration
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+
+#include "event_ctrl.hpp"
+#include "event_table.hpp"
+
+
+ESP_EVENT_DEFINE_BASE(TABLE_TEST_EVENT);
+ESP_EVENT_DEFINE_BASE(TABLE_OTHER_EVENT);
+
+namespace
+{
+
+///@brief the handler counts the calls & stores the last event
+struct counting: event::handler::base
+{
+    using base::base;
+    void instance_handler(void* a, esp_event_base_t b, int32_t id, void* data) override {
+	calls++;
+	last_base = b;
+	last_id = id;
+	last_arg = a;
+	if (data)
+	    payload = *static_cast<int*>(data); };
+
+    void clear() { calls = 0; last_base = nullptr; last_id = -1; last_arg = nullptr; payload = 0; };
+
+    int calls = 0;
+    esp_event_base_t last_base = nullptr;
+    int32_t last_id = -1;
+    void* last_arg = nullptr;
+    int payload = 0;
+}; /* struct counting */
+
+int tag;
+
+counting first(TABLE_TEST_EVENT, 1, &tag);
+counting second(TABLE_TEST_EVENT, 2);
+counting second_too(TABLE_TEST_EVENT, 2);
+counting any(TABLE_TEST_EVENT, ESP_EVENT_ANY_ID);
+counting other(TABLE_OTHER_EVENT, 1);
+
+// the handlers are not in the id order: the table sorts them at the enroll
+using test_table = event::table<second, other, any, first, second_too>;
+using single = event::table<first>;
+
+///@brief the event loop w/o the task: dispatched by the test itself
+class table_loop: public ::testing::Test
+{
+protected:
+    void SetUp() override {
+	    esp_event_loop_args_t args = {16, nullptr, 0, 0, 0};
+
+	ASSERT_EQ(esp_event_loop_create(&args, &loop), ESP_OK);
+	for (counting* h: {&first, &second, &second_too, &any, &other})
+	    h->clear(); };
+    void TearDown() override {
+	test_table::unreg();
+	single::unreg();
+	esp_event_loop_delete(loop); };
+
+    void post(esp_event_base_t base, int32_t id, int payload = 0) {
+	ASSERT_EQ(esp_event_post_to(loop, base, id, &payload, sizeof(payload), 0), ESP_OK);
+	esp_event_loop_run(loop, 0); };
+
+    esp_event_loop_handle_t loop;
+}; /* class table_loop */
+
+}; /* namespace */
+
+
+TEST_F(table_loop, dispatch_by_base_and_id)
+{
+    EXPECT_EQ(test_table::size, 5u);
+    ASSERT_EQ(test_table::enroll_to(loop), ESP_OK);
+    EXPECT_TRUE(test_table::enrolled());
+
+    post(TABLE_TEST_EVENT, 1, 11);
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(first.payload, 11);
+    EXPECT_EQ(first.last_arg, &tag);
+    EXPECT_EQ(second.calls + second_too.calls + other.calls, 0);
+
+    // the both handlers of the same id are called
+    post(TABLE_TEST_EVENT, 2, 22);
+    EXPECT_EQ(second.calls, 1);
+    EXPECT_EQ(second_too.calls, 1);
+    EXPECT_EQ(second.payload, 22);
+    EXPECT_EQ(first.calls, 1);
+
+    // the other base is the other group
+    post(TABLE_OTHER_EVENT, 1, 33);
+    EXPECT_EQ(other.calls, 1);
+    EXPECT_EQ(other.last_base, TABLE_OTHER_EVENT);
+    EXPECT_EQ(first.calls, 1);
+
+    // no handler of the id: the ANY_ID handler only
+    post(TABLE_TEST_EVENT, 7);
+    EXPECT_EQ(any.calls, 3);
+    EXPECT_EQ(any.last_id, 7);
+    EXPECT_EQ(first.calls + second.calls + second_too.calls, 3);
+}; /* dispatch_by_base_and_id */
+
+TEST_F(table_loop, unreg_stops_the_dispatch)
+{
+    ASSERT_EQ(test_table::enroll_to(loop), ESP_OK);
+    post(TABLE_TEST_EVENT, 1);
+    EXPECT_EQ(test_table::unreg(), ESP_OK);
+    EXPECT_FALSE(test_table::enrolled());
+    post(TABLE_TEST_EVENT, 1);
+    post(TABLE_OTHER_EVENT, 1);
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(any.calls, 1);
+    EXPECT_EQ(other.calls, 0);
+
+    // nothing to unregister: no error
+    EXPECT_EQ(test_table::unreg(), ESP_OK);
+}; /* unreg_stops_the_dispatch */
+
+TEST_F(table_loop, repeated_enroll_is_rejected)
+{
+    ASSERT_EQ(single::enroll_to(loop), ESP_OK);
+    EXPECT_EQ(single::enroll_to(loop), ESP_ERR_INVALID_STATE);
+    post(TABLE_TEST_EVENT, 1);
+    EXPECT_EQ(first.calls, 1);
+
+    // the first registration is kept & is unregistered completely
+    EXPECT_EQ(single::unreg(), ESP_OK);
+    post(TABLE_TEST_EVENT, 1);
+    EXPECT_EQ(first.calls, 1);
+
+    // & may be registered again
+    ASSERT_EQ(single::enroll_to(loop), ESP_OK);
+    post(TABLE_TEST_EVENT, 1);
+    EXPECT_EQ(first.calls, 2);
+}; /* repeated_enroll_is_rejected */
+
+TEST_F(table_loop, rebuilt_by_the_handler_ids_at_enroll)
+{
+    // the handler changes the id while the table is not registered
+    first.event = 5;
+    ASSERT_EQ(single::enroll_to(loop), ESP_OK);
+    post(TABLE_TEST_EVENT, 1);
+    post(TABLE_TEST_EVENT, 5);
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(first.last_id, 5);
+    first.event = 1;
+}; /* rebuilt_by_the_handler_ids_at_enroll */
+
+TEST(table, automatic_on_the_default_loop)
+{
+    ASSERT_EQ(esp_event_loop_create_default(), ESP_OK);
+    first.clear();
+    {
+	    single::automatic reg;
+
+	EXPECT_FALSE(single::enrolled());
+	EXPECT_EQ(reg.enroll(), ESP_OK);
+	EXPECT_TRUE(single::enrolled());
+    }
+    EXPECT_FALSE(single::enrolled());
+    esp_event_loop_delete_default();
+}; /* automatic_on_the_default_loop */
@@ -0,0 +1,293 @@
+/*!@file test_task_pool.cpp
+ *
+ * @brief Tests of the work-stealing task pool: the Chase-Lev deque, the wait group blocking & the exactly once wakeup,
+ *	  submit, parallel_for & the nested fork/join, the waiting timeouts
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "asemaphore"
+#include "task_pool.hpp"
+
+
+using namespace std::chrono_literals;
+
+TEST(ws_deque, owner_lifo_thief_fifo)
+{
+	aso::ws_deque<int, 4> deque;
+	int v;
+
+    EXPECT_TRUE(deque.empty());
+    EXPECT_FALSE(deque.pop(v));
+    EXPECT_FALSE(deque.steal(v));
+    for (int i = 0; i < 4; i++)
+	EXPECT_TRUE(deque.push(i));
+    EXPECT_FALSE(deque.push(4));
+    ASSERT_TRUE(deque.steal(v));
+    EXPECT_EQ(v, 0);
+    ASSERT_TRUE(deque.pop(v));
+    EXPECT_EQ(v, 3);
+    ASSERT_TRUE(deque.pop(v));
+    EXPECT_EQ(v, 2);
+    ASSERT_TRUE(deque.steal(v));
+    EXPECT_EQ(v, 1);
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(ws_deque, thieves_and_owner_take_every_item_once)
+{
+	constexpr int items = 20000, thieves = 3;
+	aso::ws_deque<int, 64> deque;
+	std::vector<std::atomic<int>> taken(items);
+	std::atomic<int> total {0};
+	std::vector<std::thread> threads;
+
+    for (int t = 0; t < thieves; t++)
+	threads.emplace_back([&] {
+		int v;
+
+	    while (total.load(std::memory_order_relaxed) < items)
+		if (deque.steal(v))
+		{
+		    taken[v]++;
+		    total++;
+		}
+		else
+		    std::this_thread::yield();
+	});
+    for (int i = 0, v; i < items;)
+    {
+	if (deque.push(i))
+	    i++;
+	else
+	    std::this_thread::yield();
+	// the owner takes the part of the items itself
+	if ((i & 3) == 0 && deque.pop(v))
+	{
+	    taken[v]++;
+	    total++;
+	}
+    }
+    for (int v; total.load() < items;)
+	if (deque.pop(v))
+	{
+	    taken[v]++;
+	    total++;
+	}
+    for (auto& t: threads)
+	t.join();
+
+	int wrong = 0;
+
+    for (auto& n: taken)
+	wrong += n != 1;
+    EXPECT_EQ(wrong, 0);
+}
+
+
+TEST(wait_group, empty_group_is_finished)
+{
+	aso::wait_group wg;
+
+    EXPECT_TRUE(wg.finished());
+    EXPECT_TRUE(wg.wait(0));
+    EXPECT_TRUE(wg.wait());
+}
+
+TEST(wait_group, blocks_up_to_the_last_done)
+{
+	aso::wait_group wg;
+	std::atomic<int> finished {0};
+
+    wg.add(3);
+	std::thread worker([&] {
+	    for (int i = 0; i < 3; i++)
+	    {
+		std::this_thread::sleep_for(10ms);
+		finished++;
+		wg.done();
+	    }
+	});
+
+	auto start = std::chrono::steady_clock::now();
+
+    EXPECT_TRUE(wg.wait());
+    EXPECT_EQ(finished, 3);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 25ms);
+    worker.join();
+}
+
+TEST(wait_group, timeout_then_reuse_without_stale_wakeup)
+{
+	aso::wait_group wg;
+	TickType_t start = xTaskGetTickCount();
+
+    wg.add();
+    EXPECT_FALSE(wg.wait(3));
+    EXPECT_GE(xTaskGetTickCount() - start, 3u);
+
+    // nobody waits: the last done() gives nothing
+    wg.done();
+    EXPECT_TRUE(wg.finished());
+    EXPECT_TRUE(wg.wait(0));
+
+    // the next round is not woken by the stale give
+    wg.add();
+    EXPECT_FALSE(wg.wait(2));
+    wg.done();
+    EXPECT_TRUE(wg.wait());
+}
+
+TEST(wait_group, waiter_destroys_the_group_at_once)
+{
+    // the group lives on the stack of the waiter: done() must not touch it after the wakeup
+    for (int round = 0; round < 2000; round++)
+    {
+	    auto wg = std::make_unique<aso::wait_group>();
+
+	wg->add(2);
+	    std::thread a([g = wg.get()] { g->done(); });
+	    std::thread b([g = wg.get()] { g->done(); });
+
+	ASSERT_TRUE(wg->wait());
+	wg.reset();
+	a.join();
+	b.join();
+    }
+}
+
+TEST(wait_group, racing_timeouts_keep_exactly_once)
+{
+	aso::wait_group wg;
+
+    for (int round = 0; round < 500; round++)
+    {
+	wg.add();
+	    std::thread worker([&] { wg.done(); });
+
+	// the short waits race with the done(): either times out & withdraws, or consumes the give
+	while (!wg.wait(round & 1))
+	    ;
+	worker.join();
+    }
+    // no give was left over
+    wg.add();
+    EXPECT_FALSE(wg.wait(2));
+    wg.done();
+    EXPECT_TRUE(wg.wait());
+}
+
+TEST(wait_group, one_waiter_at_a_time)
+{
+    EXPECT_DEATH({
+	    aso::wait_group wg;
+
+	wg.add();
+	std::thread other([&] { wg.wait(); });
+	std::this_thread::sleep_for(20ms);
+	wg.wait();
+    }, "");
+}
+
+
+TEST(task_pool, submit_and_wait)
+{
+	aso::task_pool pool(4);
+	aso::wait_group wg;
+	std::atomic<int> runs {0};
+
+    EXPECT_EQ(pool.size(), 4u);
+    for (int i = 0; i < 1000; i++)
+	pool.submit([&] { runs++; }, &wg);
+    EXPECT_TRUE(pool.wait(wg));
+    EXPECT_EQ(runs, 1000);
+}
+
+TEST(task_pool, parallel_for_covers_the_range_once)
+{
+	aso::task_pool pool(3);
+
+    for (size_t grain: {0, 1, 7, 64, 5000})
+    {
+	    std::vector<std::atomic<int>> hits(4099);
+
+	pool.parallel_for(3, hits.size(), grain, [&](size_t b, size_t e) {
+	    for (size_t i = b; i < e; i++)
+		hits[i]++;
+	});
+	for (size_t i = 0; i < hits.size(); i++)
+	    ASSERT_EQ(hits[i], i < 3? 0: 1) << "grain " << grain << ", index " << i;
+    }
+}
+
+TEST(task_pool, nested_parallel_reduction)
+{
+	aso::task_pool pool(4);
+	std::vector<uint32_t> data(1 << 16);
+	std::atomic<uint64_t> sum {0};
+
+    std::iota(data.begin(), data.end(), 1u);
+    // the outer chunks fork the inner ones from the worker tasks
+    pool.parallel_for(0, data.size(), data.size() / 8, [&](size_t b, size_t e) {
+	pool.parallel_for(b, e, 512, [&](size_t ib, size_t ie) {
+		uint64_t part = 0;
+
+	    for (size_t i = ib; i < ie; i++)
+		part += data[i];
+	    sum += part;
+	});
+    });
+    EXPECT_EQ(sum, uint64_t(data.size()) * (data.size() + 1) / 2);
+}
+
+TEST(task_pool, wait_timeout_while_the_job_blocks)
+{
+	aso::task_pool pool(2);
+	aso::wait_group wg;
+	asemaphore gate(false);
+	std::atomic<bool> started {false};
+
+    // the job is running by the worker, not by the helping waiter
+    pool.submit([&] { started = true; gate.Take(); }, &wg);
+    while (!started)
+	std::this_thread::yield();
+
+	TickType_t start = xTaskGetTickCount();
+
+    EXPECT_FALSE(pool.wait(wg, 3));
+    EXPECT_GE(xTaskGetTickCount() - start, 3u);
+    gate.Give();
+    EXPECT_TRUE(pool.wait(wg));
+}
+
+TEST(task_pool, inline_run_when_no_job_left)
+{
+	aso::task_pool pool(1, 5, 4096, 2);
+	aso::wait_group wg;
+	asemaphore gate(false);
+	std::atomic<int> runs {0};
+	int inlined = 0;
+
+    // the both jobs of the pool are busy: the rest submits are run by the caller
+    pool.submit([&] { gate.Take(); runs++; }, &wg);
+    pool.submit([&] { runs++; }, &wg);
+    for (int i = 0; i < 5; i++)
+	inlined += !pool.submit([&] { runs++; }, &wg);
+    EXPECT_EQ(inlined, 5);
+    gate.Give();
+    EXPECT_TRUE(pool.wait(wg));
+    EXPECT_EQ(runs, 7);
+}
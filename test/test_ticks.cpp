@@ -0,0 +1,205 @@
+/*!@file test_ticks.cpp
+ *
+ * @brief Tests of the timeouts layer: duration to ticks conversion & the rounding policy,
+ *	  the legacy msticks()/secticks(), the deadlines & the accuracy of the timed Take
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <esp_event.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <chrono>
+#include <thread>
+
+#include "asemaphore"
+#include "event_ctrl.hpp"
+#include "sync.hpp"
+#include "ticks.hpp"
+
+
+using namespace std::chrono_literals;
+namespace ticks = aso::ticks;
+using ticks::rounding;
+
+static_assert(configTICK_RATE_HZ == 100, "the expectations below are for the 10 ms tick");
+
+// compile-time conversion
+static_assert(ticks::of(10ms) == 1);
+static_assert(ticks::of(1ms) == 1);
+static_assert(ticks::of(0ms) == 0);
+static_assert(ticks::of(-5ms) == 0);
+static_assert(msticks(1000) == 100);
+static_assert(secticks(2) == 200);
+
+
+TEST(ticks, rounding_policy)
+{
+    EXPECT_EQ(ticks::of<rounding::up>(15ms), 2u);
+    EXPECT_EQ(ticks::of<rounding::down>(15ms), 1u);
+    EXPECT_EQ(ticks::of<rounding::nearest>(14ms), 1u);
+    EXPECT_EQ(ticks::of<rounding::nearest>(16ms), 2u);
+    // half to even
+    EXPECT_EQ(ticks::of<rounding::nearest>(15ms), 2u);
+    EXPECT_EQ(ticks::of<rounding::nearest>(25ms), 2u);
+
+    EXPECT_EQ(ticks::of<rounding::up>(10001us), 2u);
+    EXPECT_EQ(ticks::of<rounding::down>(9999us), 0u);
+    EXPECT_EQ(ticks::of<rounding::up>(1ns), 1u);
+    EXPECT_EQ(ticks::of(std::chrono::duration<double>(0.025)), 3u);
+    EXPECT_EQ(ticks::of(std::chrono::duration<double, std::milli>(20.0)), 2u);
+}
+
+TEST(ticks, exact_multiples_are_not_rounded)
+{
+    for (int ms = 0; ms <= 100000; ms += 10)
+    {
+	ASSERT_EQ(ticks::of<rounding::up>(std::chrono::milliseconds(ms)), TickType_t(ms / 10)) << ms;
+	ASSERT_EQ(ticks::of<rounding::down>(std::chrono::milliseconds(ms)), TickType_t(ms / 10)) << ms;
+	ASSERT_EQ(ticks::of<rounding::nearest>(std::chrono::milliseconds(ms)), TickType_t(ms / 10)) << ms;
+    }
+}
+
+TEST(ticks, legacy_helpers)
+{
+    EXPECT_EQ(msticks(0), 0u);
+    EXPECT_EQ(msticks(1), 1u);
+    EXPECT_EQ(msticks(10), 1u);
+    EXPECT_EQ(msticks(11), 2u);
+    EXPECT_EQ(msticks(250), 25u);
+    EXPECT_EQ(secticks(1), 100u);
+    EXPECT_EQ(secticks(3600), 360000u);
+    EXPECT_EQ(secticks(1), msticks(SEC2mSEC));
+}
+
+TEST(ticks, saturation)
+{
+    EXPECT_EQ(ticks::of(std::chrono::hours(24 * 365 * 10000)), ticks::longest);
+    EXPECT_EQ(ticks::of(std::chrono::duration<double>(1e300)), ticks::longest);
+    EXPECT_NE(ticks::of(std::chrono::hours(24 * 365 * 10000)), ticks::forever);
+    EXPECT_EQ(ticks::of(std::chrono::seconds::min()), 0u);
+}
+
+TEST(ticks, deadline_arithmetic)
+{
+	TickType_t now = xTaskGetTickCount();
+	ticks::deadline past(ticks::tick(TickType_t(now - 3)));
+	ticks::deadline future(ticks::tick(TickType_t(now + 1000)));
+
+    EXPECT_TRUE(ticks::expired(past));
+    EXPECT_EQ(ticks::remaining(past), 0u);
+    EXPECT_LE(ticks::until(past), -3);
+    EXPECT_FALSE(ticks::expired(future));
+    EXPECT_LE(ticks::remaining(future), 1000u);
+    EXPECT_GE(ticks::remaining(future), 990u);
+}
+
+///@brief the deadline across the wraparound of the tick counter: the counter wraps, the signed distance is still right
+TEST(ticks, deadline_wraparound)
+{
+	using signed_ticks = std::make_signed_t<TickType_t>;
+	// 10 ticks before the wrap, the deadline is 15 ticks later
+	ticks::deadline before_wrap(ticks::tick(TickType_t(-10)));
+	ticks::deadline dl = before_wrap + ticks::tick(15);
+
+    EXPECT_EQ(dl.time_since_epoch().count(), 5u);
+    EXPECT_EQ(static_cast<signed_ticks>(dl.time_since_epoch().count() - before_wrap.time_since_epoch().count()), 15);
+    EXPECT_EQ(static_cast<signed_ticks>(before_wrap.time_since_epoch().count() - dl.time_since_epoch().count()), -15);
+}
+
+///@brief the deadline is clamped to the half of the tick counter range: the longer one would be expired at once
+TEST(ticks, far_deadline_is_clamped)
+{
+    static_assert(ticks::farthest == TickType_t(-1) / 2);
+
+    for (auto dl: {ticks::after(std::chrono::hours(24 * 365 * 10000)), ticks::after(ticks::tick(ticks::longest)),
+		   ticks::after(ticks::tick(ticks::farthest + 1))})
+    {
+	EXPECT_FALSE(ticks::expired(dl));
+	EXPECT_GT(ticks::until(dl), 0);
+	EXPECT_GE(ticks::remaining(dl), ticks::farthest - 1);
+	EXPECT_NE(ticks::remaining(dl), ticks::forever);
+    }
+
+    // the shorter ones are not changed
+	auto dl = ticks::after(ticks::tick(ticks::farthest - 100));
+
+    EXPECT_LE(ticks::remaining(dl), ticks::farthest - 100);
+    EXPECT_GE(ticks::remaining(dl), ticks::farthest - 101);
+}
+
+
+//--[ accuracy of the timed waits ]------------------------------------------------------------------------------------
+
+namespace
+{
+
+///@brief elapsed time of the call
+template <typename Body>
+std::chrono::steady_clock::duration elapsed(Body&& body)
+{
+	auto start = std::chrono::steady_clock::now();
+
+    body();
+    return std::chrono::steady_clock::now() - start;
+}; /* elapsed() */
+
+constexpr auto tick = std::chrono::milliseconds(1000 / configTICK_RATE_HZ);
+
+}; /* namespace */
+
+///@brief the timed Take is not shorter than requested & not longer by more than a tick (+ the host scheduling slack)
+TEST(ticks, take_duration_accuracy)
+{
+	asemaphore sem(false);
+
+    for (auto timeout: {10ms, 35ms, 100ms})
+    {
+	    auto took = elapsed([&] { EXPECT_EQ(sem.Take(timeout), pdFALSE); });
+
+	EXPECT_GE(took, timeout - tick) << timeout.count();
+	EXPECT_LT(took, timeout + 2 * tick + 20ms) << timeout.count();
+    }
+}
+
+///@brief the retry loop w/ the deadline: the spurious wakeups don't extend the total wait
+TEST(ticks, take_until_survives_wakeups)
+{
+	asemaphore sem(false);
+	std::atomic<bool> stop {false};
+	std::thread waker([&] {
+	    while (!stop)
+	    {
+		sem.Give();
+		std::this_thread::sleep_for(15ms);
+	    }
+	});
+	ticks::deadline dl = ticks::after(150ms);
+	int wakeups = 0;
+
+	auto took = elapsed([&] {
+	    // the condition is never met: wait up to the deadline
+	    while (sem.Take_until(dl) == pdTRUE)
+		wakeups++;
+	});
+
+    stop = true;
+    waker.join();
+    EXPECT_GT(wakeups, 3);
+    EXPECT_GE(took, 150ms - tick);
+    EXPECT_LT(took, 150ms + 2 * tick + 30ms);
+    EXPECT_TRUE(ticks::expired(dl));
+}
+
+TEST(ticks, take_until_expired_does_not_block)
+{
+	asemaphore sem(false);
+	ticks::deadline dl = ticks::after(0ms);
+
+    EXPECT_LT(elapsed([&] { EXPECT_EQ(sem.Take_until(dl), pdFALSE); }), 5ms);
+}
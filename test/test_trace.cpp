@@ -0,0 +1,156 @@
+/*!@file test_trace.cpp
+ *
+ * @brief Tests of the binary trace ring buffer (CONFIG_ASO_UTILS_TRACE_RING)
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "asemaphore"
+#include "trace.hpp"
+
+
+namespace
+{
+
+constexpr size_t ring_size = CONFIG_ASO_UTILS_TRACE_RING_SIZE;
+
+struct trace_ring: ::testing::Test
+{
+    void SetUp() override
+    {
+	    aso::trace::record buf[ring_size];
+
+	while (aso::trace::drain(buf, ring_size))
+	    ;
+	lost_before = aso::trace::lost();
+    };
+
+    uint32_t lost_before = 0;
+}; /* struct trace_ring */
+
+const void* handle_of(uintptr_t v) { return reinterpret_cast<const void*>(v); };
+
+}; /* namespace */
+
+
+TEST_F(trace_ring, empty)
+{
+	aso::trace::record out[4];
+
+    EXPECT_EQ(aso::trace::drain(out, 4), 0u);
+}
+
+TEST_F(trace_ring, semaphore_operations_are_traced)
+{
+	aso::trace::record out[8];
+	asemaphore sem(true);
+
+    sem.Take(0);
+    sem.Take(0);
+
+	size_t cnt = aso::trace::drain(out, 8);
+
+    ASSERT_EQ(cnt, 4u);
+    EXPECT_EQ(out[0].oper, aso::trace::init);
+    EXPECT_EQ(out[1].oper, aso::trace::give);
+    EXPECT_EQ(out[2].oper, aso::trace::take);
+    EXPECT_EQ(out[2].result, pdTRUE);
+    EXPECT_EQ(out[3].oper, aso::trace::take);
+    EXPECT_EQ(out[3].result, pdFALSE);
+    for (size_t i = 1; i < cnt; i++)
+    {
+	EXPECT_EQ(out[i].handle, out[0].handle);
+	EXPECT_GE(int32_t(out[i].stamp - out[i - 1].stamp), 0);
+    }
+}
+
+TEST_F(trace_ring, partial_drain_keeps_the_order)
+{
+	aso::trace::record out[ring_size];
+
+    for (uintptr_t i = 0; i < 10; i++)
+	aso::trace::put(aso::trace::event, handle_of(i), int(i));
+
+    ASSERT_EQ(aso::trace::drain(out, 4), 4u);
+    for (uintptr_t i = 0; i < 4; i++)
+	EXPECT_EQ(out[i].handle, handle_of(i));
+    ASSERT_EQ(aso::trace::drain(out, ring_size), 6u);
+    for (uintptr_t i = 0; i < 6; i++)
+	EXPECT_EQ(out[i].handle, handle_of(i + 4));
+    EXPECT_EQ(aso::trace::lost(), lost_before);
+}
+
+TEST_F(trace_ring, overflow_counts_the_lost)
+{
+	aso::trace::record out[ring_size];
+
+    for (uintptr_t i = 0; i < ring_size + 10; i++)
+	aso::trace::put(aso::trace::event, handle_of(i), 0);
+
+    ASSERT_EQ(aso::trace::drain(out, ring_size), ring_size);
+    EXPECT_EQ(out[0].handle, handle_of(10));
+    EXPECT_EQ(out[ring_size - 1].handle, handle_of(ring_size + 9));
+    EXPECT_EQ(aso::trace::lost() - lost_before, 10u);
+}
+
+///@brief the writers racing with the drain: the drained records are never torn nor stale, nothing is missed
+TEST_F(trace_ring, concurrent_writers_and_drain)
+{
+	constexpr unsigned writers = 4;
+	constexpr uintptr_t per_writer = 50000;
+	std::atomic<unsigned> running {writers};
+	std::vector<std::thread> threads;
+	aso::trace::record out[ring_size];
+	size_t drained = 0;
+	size_t torn = 0;
+	size_t stale = 0;
+	uintptr_t last[writers] {};
+
+    auto check = [&](size_t cnt) {
+	for (size_t i = 0; i < cnt; i++)
+	{
+		uintptr_t v = reinterpret_cast<uintptr_t>(out[i].handle);
+
+	    // all the fields of the record are derived from the one value
+	    if (out[i].result != int8_t(v & 0x7f) || out[i].oper != aso::trace::op(v % 5))
+		torn++;
+	    // the records of the each writer are drained in the order of the writing, w/o the previous laps
+	    else if (uintptr_t& prev = last[v / per_writer]; v + 1 <= prev)
+		stale++;
+	    else
+		prev = v + 1;
+	}
+	drained += cnt;
+    };
+
+    for (unsigned w = 0; w < writers; w++)
+	threads.emplace_back([&, w] {
+	    for (uintptr_t i = 0; i < per_writer; i++)
+	    {
+		    uintptr_t v = w * per_writer + i;
+
+		aso::trace::put(aso::trace::op(v % 5), handle_of(v), int(v & 0x7f));
+	    }
+	    running--;
+	});
+    while (running)
+	check(aso::trace::drain(out, ring_size));
+    for (auto& t: threads)
+	t.join();
+    while (size_t cnt = aso::trace::drain(out, ring_size))
+	check(cnt);
+
+    EXPECT_EQ(torn, 0u);
+    EXPECT_EQ(stale, 0u);
+    EXPECT_EQ(drained + (aso::trace::lost() - lost_before), writers * per_writer);
+}
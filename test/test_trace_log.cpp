@@ -0,0 +1,64 @@
+/*!@file test_trace_log.cpp
+ *
+ * @brief Tests of the text log tracing (CONFIG_ASO_UTILS_TRACE_LOG)
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+
+#include <esp_log.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "asemaphore"
+#include "trace.hpp"
+
+
+namespace
+{
+
+std::string captured;
+
+int capture(const char* fmt, va_list args)
+{
+	char buf[256];
+	int len = std::vsnprintf(buf, sizeof(buf), fmt, args);
+
+    captured += buf;
+    return len;
+}; /* capture() */
+
+}; /* namespace */
+
+
+TEST(trace_log, operations_are_logged)
+{
+	vprintf_like_t prev = esp_log_set_vprintf(capture);
+	asemaphore sem(true);
+
+    captured.clear();
+    sem.Take(0);
+    esp_log_set_vprintf(prev);
+
+    EXPECT_NE(captured.find("aso::trace"), std::string::npos) << captured;
+    EXPECT_NE(captured.find("Take"), std::string::npos) << captured;
+}
+
+TEST(trace_log, not_logged_from_isr)
+{
+	vprintf_like_t prev = esp_log_set_vprintf(capture);
+	asemaphore sem(true);
+	BaseType_t woken = pdFALSE;
+
+    captured.clear();
+    sem.TakeFromISR(&woken);
+    esp_log_set_vprintf(prev);
+
+    EXPECT_TRUE(captured.empty()) << captured;
+}
@@ -0,0 +1,115 @@
+/*!@file ticks.hpp
+ *
+ * @brief Timeouts in the FreeRTOS ticks: std::chrono durations to ticks conversion with the rounding policy,
+ *	  tick clock & absolute deadlines with the wraparound-safe arithmetic
+ *
+ * @note  Need pre-included including files freertos/FreeRTOS.h & freertos/task.h
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __TICKS_HPP__
+#define __TICKS_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+namespace aso
+{
+    namespace ticks
+    {
+
+	///@brief rounding of the duration to the ticks
+	enum class rounding {
+	    down,	///< truncate: wait not longer than requested
+	    up,		///< ceil: wait not shorter than requested
+	    nearest	///< nearest tick, half to even
+	};
+
+	///@brief duration of the one tick
+	using tick = std::chrono::duration<TickType_t, std::ratio<1, configTICK_RATE_HZ>>;
+
+	///@brief wait forever
+	constexpr TickType_t forever = portMAX_DELAY;
+
+	///@brief the longest finite wait: the portMAX_DELAY means forever
+	constexpr TickType_t longest = portMAX_DELAY - 1;
+
+	///@brief the farthest deadline from now: the deadlines are compared by the signed distance,
+	/// half of the tick counter range
+	constexpr TickType_t farthest = std::numeric_limits<std::make_signed_t<TickType_t>>::max();
+
+
+	///@brief convert the duration to ticks; negative duration is 0 ticks, too long one is the longest finite wait
+	template <rounding R = rounding::up, class Rep, class Period>
+	constexpr TickType_t of(std::chrono::duration<Rep, Period> d)
+	{
+		using wide = std::chrono::duration<int64_t, tick::period>;
+		wide t {};
+
+	    if (d <= d.zero())
+		return 0;
+	    if (std::chrono::duration<double, tick::period>(d).count() >= longest)
+		return longest;
+
+	    if constexpr (R == rounding::down)
+		t = std::chrono::floor<wide>(d);
+	    else if constexpr (R == rounding::up)
+		t = std::chrono::ceil<wide>(d);
+	    else
+		t = std::chrono::round<wide>(d);
+
+	    return static_cast<TickType_t>(t.count());
+	}; /* of() */
+
+
+	///@brief FreeRTOS tick counter as the std::chrono clock; the tick counter wraps around,
+	/// so compare the time points by the expired()/remaining() only
+	struct clock
+	{
+	    using rep = TickType_t;
+	    using period = tick::period;
+	    using duration = tick;
+	    using time_point = std::chrono::time_point<clock>;
+	    static constexpr bool is_steady = true;
+
+	    static time_point now() { return time_point(tick(xTaskGetTickCount())); };
+	}; /* clock */
+
+	///@brief absolute deadline: survive the spurious wakeups & retry loops
+	using deadline = clock::time_point;
+
+
+	///@brief deadline after the timeout from now; the timeout longer than the farthest deadline is clamped to it
+	template <rounding R = rounding::up, class Rep, class Period>
+	inline deadline after(std::chrono::duration<Rep, Period> d) {
+	    TickType_t t = of<R>(d);
+	    return clock::now() + tick(t < farthest? t: farthest); };
+
+	///@brief signed ticks from now to the deadline: wraparound-safe while the distance is less than half of the counter range
+	inline std::make_signed_t<TickType_t> until(deadline dl) {
+	    return static_cast<std::make_signed_t<TickType_t>>(dl.time_since_epoch().count() - xTaskGetTickCount()); };
+
+	///@brief is the deadline expired?
+	inline bool expired(deadline dl) {
+	    return until(dl) <= 0; };
+
+	///@brief ticks remaining to the deadline; 0 if expired
+	inline TickType_t remaining(deadline dl) {
+	    auto left = until(dl);
+	    return left > 0? static_cast<TickType_t>(left): 0; };
+
+    }; /* namespace ticks */
+
+}; /* namespace aso */
+
+
+#endif /* __TICKS_HPP__ */
@@ -0,0 +1,120 @@
+/*!@file trace.cpp
+ *
+ * @brief Compile-time configurable tracing of the semaphores & event synchronizers operations;
+ *	  implementation of the binary trace ring buffer
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#include <atomic>
+
+#include <esp_attr.h>
+#include <esp_timer.h>
+
+#include "trace.hpp"
+
+
+#if CONFIG_ASO_UTILS_TRACE_RING
+
+namespace aso
+{
+    namespace trace
+    {
+	namespace
+	{
+	    constexpr uint32_t size = CONFIG_ASO_UTILS_TRACE_RING_SIZE;
+	    static_assert((size & (size - 1)) == 0, "CONFIG_ASO_UTILS_TRACE_RING_SIZE must be a power of 2");
+
+	    ///@brief slot of the ring: the record & it's commit word
+	    struct slot
+	    {
+		/// position of the record + 1 when the record is committed; (position + 1) ^ 1 while writing,
+		/// that never matches the commit of the any lap of this slot
+		std::atomic<uint32_t> seq {0};
+		record rec;
+	    }; /* slot */
+
+	    slot ring[size];			///< trace ring buffer
+	    std::atomic<uint32_t> head {0};	///< count of the records was put
+	    uint32_t tail = 0;			///< count of the records was drained or lost
+	    std::atomic<uint32_t> lost_cnt {0};	///< count of the lost records
+
+	}; /* namespace */
+
+
+	///@brief put the record to the trace ring buffer; lock-free, callable from ISR
+	void IRAM_ATTR put(op oper, const void* handle, int result)
+	{
+		uint32_t pos = head.fetch_add(1, std::memory_order_relaxed);
+		slot& sl = ring[pos & (size - 1)];
+
+	    // invalidate the slot for the reader before the fields are changed
+	    sl.seq.store((pos + 1) ^ 1, std::memory_order_relaxed);
+	    std::atomic_thread_fence(std::memory_order_release);
+
+	    sl.rec.stamp = static_cast<uint32_t>(esp_timer_get_time());
+	    sl.rec.handle = handle;
+	    sl.rec.oper = oper;
+	    sl.rec.result = static_cast<int8_t>(result);
+
+	    sl.seq.store(pos + 1, std::memory_order_release);
+	}; /* aso::trace::put() */
+
+
+	///@brief drain the accumulated records from the trace ring buffer to the out array, oldest first
+	size_t drain(record out[], size_t n)
+	{
+		uint32_t last = head.load(std::memory_order_acquire);
+		size_t cnt = 0;
+
+	    if (last - tail > size)
+	    {
+		lost_cnt.fetch_add(last - tail - size, std::memory_order_relaxed);
+		tail = last - size;
+	    }; /* if last - tail > size */
+
+	    for (; tail != last && cnt < n; tail++)
+	    {
+		    slot& sl = ring[tail & (size - 1)];
+		    uint32_t seq = sl.seq.load(std::memory_order_acquire);
+
+		if (seq != tail + 1)
+		{
+		    // the writer of this record is not finished yet: leave it for the next drain,
+		    // unless the record is already overwritten by the next lap
+		    if (head.load(std::memory_order_acquire) - tail <= size)
+			break;
+		    lost_cnt.fetch_add(1, std::memory_order_relaxed);
+		    continue;
+		}; /* if seq != tail + 1 */
+
+		out[cnt] = sl.rec;
+		// the record was overwritten while copying?
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (sl.seq.load(std::memory_order_relaxed) != seq)
+		{
+		    lost_cnt.fetch_add(1, std::memory_order_relaxed);
+		    continue;
+		}; /* if seq was changed */
+		cnt++;
+	    }; /* for tail != last && cnt < n */
+
+	    return cnt;
+	}; /* aso::trace::drain() */
+
+
+	///@brief count of the records lost (overwritten before was drained)
+	uint32_t lost()
+	{
+	    return lost_cnt.load(std::memory_order_relaxed);
+	}; /* aso::trace::lost() */
+
+    }; /* namespace trace */
+
+}; /* namespace aso */
+
+#endif	// CONFIG_ASO_UTILS_TRACE_RING
+
+
+//--[ trace.cpp ]------------------------------------------------------------------------------------------------------
@@ -0,0 +1,88 @@
+/*!@file trace.hpp
+ *
+ * @brief Compile-time configurable tracing of the semaphores & event synchronizers operations;
+ *	  selected by the Kconfig option ASO_UTILS_TRACE: none, binary ring buffer or text log
+ *
+ * @date Created on: 17 окт. 2026 г.
+ * @author: aso
+ */
+
+#ifndef __TRACE_HPP__
+#define __TRACE_HPP__
+
+#if !defined(__cplusplus)
+#error File __FILE__ is not intended to use with a pure C
+#endif	// __cplusplus
+
+#include <cstddef>
+#include <cstdint>
+
+#include <sdkconfig.h>
+
+
+namespace aso
+{
+    namespace trace
+    {
+	///@brief traced operations
+	enum op: uint8_t { take, give, init, del, event };
+
+	///@brief name of the traced operation
+	constexpr const char* name(op oper)
+	{
+	    switch (oper)
+	    {
+	    case take:	return "Take";
+	    case give:	return "Give";
+	    case init:	return "Init";
+	    case del:	return "del";
+	    case event:	return "event";
+	    }; /* switch oper */
+	    return "?";
+	}; /* name() */
+
+	///@brief binary trace record
+	struct record
+	{
+	    uint32_t stamp;	///< timestamp, lower 32 bits of the esp_timer_get_time(), us
+	    const void* handle;	///< handle of the traced object
+	    op oper;		///< traced operation
+	    int8_t result;	///< result of the operation
+	}; /* record */
+
+#if CONFIG_ASO_UTILS_TRACE_RING
+	///@brief put the record to the trace ring buffer; lock-free, callable from ISR
+	void put(op oper, const void* handle, int result);
+
+	///@brief drain the accumulated records from the trace ring buffer to the out array, oldest first
+	///@parameter [out] out - array for the drained records
+	///@parameter [in]  n   - capacity of the out array
+	///@return count of the drained records
+	///@note single consumer only; records overwritten by the writers while draining are counted as lost,
+	///	 the record being written yet stops the draining until the next call
+	size_t drain(record out[], size_t n);
+
+	///@brief count of the records lost (overwritten before was drained)
+	uint32_t lost();
+#endif	// CONFIG_ASO_UTILS_TRACE_RING
+
+    }; /* namespace trace */
+
+}; /* namespace aso */
+
+
+#if CONFIG_ASO_UTILS_TRACE_RING
+#define ASO_TRACE(oper, handle, result) aso::trace::put(aso::trace::oper, (handle), (result))
+#define ASO_TRACE_ISR(oper, handle, result) ASO_TRACE(oper, handle, result)
+#elif CONFIG_ASO_UTILS_TRACE_LOG
+#include <esp_log.h>
+#define ASO_TRACE(oper, handle, result) ESP_LOGI("aso::trace", "%s %p: %d", aso::trace::name(aso::trace::oper), (const void*)(handle), (int)(result))
+// text log is not allowed in the ISR
+#define ASO_TRACE_ISR(oper, handle, result) ((void)0)
+#else
+#define ASO_TRACE(oper, handle, result) ((void)0)
+#define ASO_TRACE_ISR(oper, handle, result) ((void)0)
+#endif	// CONFIG_ASO_UTILS_TRACE_RING
+
+
+#endif /* __TRACE_HPP__ */